@@ -0,0 +1,80 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef ASSIGNMENT_SOLVER_H
+#define ASSIGNMENT_SOLVER_H
+
+#include <vector>
+#include <functional>
+#include <cstddef>
+
+/**
+ * @class AssignmentSolver
+ * @brief Min-cost one-to-one matching between rows (interventions) and columns (technicians)
+ *
+ * The optimal solver is the shortest augmenting path form of the Hungarian
+ * algorithm (O(n² m)), which handles a few thousand rows in seconds. A greedy
+ * solver is kept as a baseline to compare against.
+ */
+class AssignmentSolver {
+public:
+    /**
+     * @brief Cost given to pairs that must never be matched
+     */
+    static constexpr double FORBIDDEN = 1e9;
+
+    /**
+     * @brief Dense row-major cost matrix
+     */
+    struct CostMatrix {
+        size_t rows = 0;
+        size_t cols = 0;
+        std::vector<double> costs;
+
+        /**
+         * @brief Get the cost of a pair
+         * @param row Row index
+         * @param col Column index
+         * @return The cost
+         */
+        double at(size_t row, size_t col) const { return costs[row * cols + col]; }
+    };
+
+    /**
+     * @brief Build a cost matrix, computing blocks of rows in parallel
+     * @param rows Number of rows
+     * @param cols Number of columns
+     * @param cost Cost of a (row, col) pair, FORBIDDEN if the pair is not allowed.
+     *             Called concurrently: it must only read shared state.
+     * @param threads Number of worker threads (0 for the hardware concurrency)
+     * @return The cost matrix
+     */
+    static CostMatrix buildCostMatrix(size_t rows, size_t cols,
+                                      const std::function<double(size_t, size_t)>& cost,
+                                      unsigned threads = 0);
+
+    /**
+     * @brief Find the matching of minimum total cost
+     * @param matrix The cost matrix
+     * @return Column matched to each row, or -1 if the row stays unmatched
+     */
+    static std::vector<int> solveOptimal(const CostMatrix& matrix);
+
+    /**
+     * @brief Match each row in turn with its cheapest free column
+     * @param matrix The cost matrix
+     * @return Column matched to each row, or -1 if the row stays unmatched
+     */
+    static std::vector<int> solveGreedy(const CostMatrix& matrix);
+
+    /**
+     * @brief Total cost of a matching, ignoring unmatched rows
+     * @param matrix The cost matrix
+     * @param matching Column matched to each row
+     * @return The total cost
+     */
+    static double totalCost(const CostMatrix& matrix, const std::vector<int>& matching);
+};
+
+#endif // ASSIGNMENT_SOLVER_H
@@ -0,0 +1,140 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef COMPRESSED_TRACK_H
+#define COMPRESSED_TRACK_H
+
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <ctime>
+
+/**
+ * @brief One GPS fix
+ */
+struct TrackPoint {
+    double latitude;
+    double longitude;
+    std::time_t timestamp;
+
+    TrackPoint(double lat, double lon, std::time_t time)
+        : latitude(lat), longitude(lon), timestamp(time) {}
+};
+
+/**
+ * @class CompressedTrack
+ * @brief Append-only GPS track stored in compressed blocks
+ *
+ * Coordinates are kept in fixed point (1e-7 degree, about 1 cm). Points are
+ * appended to a small uncompressed tail; every BLOCK_SIZE points the tail is
+ * sealed into an immutable block. In a block, each channel (time, latitude,
+ * longitude) is stored as zig-zag encoded deltas or deltas of deltas,
+ * whichever is smaller, bit-packed at the narrowest width that fits the
+ * block. Regular reporting intervals cost 0 bits per timestamp and a parked
+ * device almost nothing. Block headers keep their time range, so a range
+ * query only decodes the blocks it overlaps.
+ */
+class CompressedTrack {
+public:
+    static constexpr size_t BLOCK_SIZE = 256;
+    static constexpr double COORDINATE_SCALE = 1e7;
+
+private:
+    // Point in storage units
+    struct RawPoint {
+        std::int64_t time;
+        std::int64_t lat;
+        std::int64_t lon;
+    };
+
+    struct Block {
+        RawPoint first;
+        std::int64_t minTime;
+        std::int64_t maxTime;
+        std::uint16_t count;
+        std::array<std::int64_t, 3> firstDelta;   // Seed of delta-of-delta channels
+        std::array<std::uint8_t, 3> width;        // Bits per value, per channel
+        std::array<std::uint8_t, 3> deltaOfDelta; // 1 if the channel stores deltas of deltas
+        std::vector<std::uint64_t> bits;
+    };
+
+    std::vector<Block> blocks;
+    std::vector<RawPoint> tail;
+    RawPoint lastPoint;    // Kept apart so that back() never decodes a block
+    size_t pointCount;
+    bool chronological;    // True while timestamps never went backwards
+
+    /**
+     * @brief Compress the tail into a new block
+     */
+    void sealTail();
+
+    /**
+     * @brief Decode a block
+     * @param block The block
+     * @param out Receives the points
+     */
+    static void decodeBlock(const Block& block, std::vector<RawPoint>& out);
+
+    /**
+     * @brief Convert a stored point back to degrees
+     * @param raw The stored point
+     * @return The point
+     */
+    static TrackPoint toPoint(const RawPoint& raw);
+
+public:
+    /**
+     * @brief Default constructor
+     */
+    CompressedTrack();
+
+    /**
+     * @brief Append a point
+     * @param latitude Latitude in degrees
+     * @param longitude Longitude in degrees
+     * @param timestamp Time of the fix
+     */
+    void append(double latitude, double longitude, std::time_t timestamp);
+
+    /**
+     * @brief Get the number of points
+     * @return Number of points
+     */
+    size_t size() const;
+
+    /**
+     * @brief Check if the track is empty
+     * @return True if there is no point
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the last point
+     * @return The last point (undefined on an empty track)
+     */
+    TrackPoint back() const;
+
+    /**
+     * @brief Decode the whole track
+     * @return Every point, in insertion order
+     */
+    std::vector<TrackPoint> decodeAll() const;
+
+    /**
+     * @brief Decode the points of a time range
+     * @param from Start of the range (inclusive)
+     * @param to End of the range (inclusive)
+     * @return The points in the range, in insertion order
+     */
+    std::vector<TrackPoint> decodeRange(std::time_t from, std::time_t to) const;
+
+    /**
+     * @brief Get the memory used by the track
+     * @return Size in bytes
+     */
+    size_t getMemoryUsage() const;
+};
+
+#endif // COMPRESSED_TRACK_H
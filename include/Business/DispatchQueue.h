@@ -0,0 +1,119 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef DISPATCH_QUEUE_H
+#define DISPATCH_QUEUE_H
+
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <string>
+#include <ctime>
+#include <cstdint>
+
+/**
+ * @class DispatchQueue
+ * @brief Indexed priority heap of emergencies waiting for a technician
+ *
+ * Jobs are ordered by priority (highest first), then by age (oldest first).
+ * The heap keeps the position of every intervention so that removal and
+ * priority changes are O(log n) and the next job is available in O(1).
+ */
+class DispatchQueue {
+public:
+    /**
+     * @brief An emergency waiting for dispatch
+     */
+    struct Job {
+        int interventionId;
+        int priority;             // 1-5, 5 being the highest
+        std::time_t createdAt;    // Time the job entered the queue
+        std::uint64_t sequence;   // Tie-breaker for jobs created in the same second
+        std::string specialty;    // Required specialty (empty if any)
+    };
+
+private:
+    std::vector<Job> heap;
+    std::unordered_map<int, size_t> positions; // Intervention ID -> index in the heap
+    std::uint64_t nextSequence;
+
+public:
+    /**
+     * @brief Default constructor
+     */
+    DispatchQueue();
+
+    /**
+     * @brief Add a job, or update it if the intervention is already queued
+     * @param interventionId ID of the intervention
+     * @param priority Priority level (1-5)
+     * @param specialty Required specialty (empty if any)
+     * @param createdAt Time the job entered the queue
+     */
+    void push(int interventionId, int priority, const std::string& specialty = "",
+              std::time_t createdAt = std::time(nullptr));
+
+    /**
+     * @brief Remove a job
+     * @param interventionId ID of the intervention
+     * @return True if the job was queued
+     */
+    bool remove(int interventionId);
+
+    /**
+     * @brief Change the priority of a queued job
+     * @param interventionId ID of the intervention
+     * @param priority New priority level (1-5)
+     * @return True if the job was queued
+     */
+    bool updatePriority(int interventionId, int priority);
+
+    /**
+     * @brief Get the most urgent job
+     * @return Pointer to the job, or nullptr if the queue is empty
+     */
+    const Job* top() const;
+
+    /**
+     * @brief Visit the jobs from the most urgent to the least
+     * @param visit Called for each job, returns false to stop
+     *
+     * The heap is walked best-first, so stopping after k jobs costs O(k log k).
+     */
+    void visitInOrder(const std::function<bool(const Job&)>& visit) const;
+
+    /**
+     * @brief Check if an intervention is queued
+     * @param interventionId ID of the intervention
+     * @return True if queued
+     */
+    bool contains(int interventionId) const;
+
+    /**
+     * @brief Get the number of queued jobs
+     * @return Number of jobs
+     */
+    size_t size() const;
+
+    /**
+     * @brief Check if the queue is empty
+     * @return True if no job is queued
+     */
+    bool empty() const;
+
+private:
+    /**
+     * @brief Check if a job must be dispatched before another
+     * @param a First job
+     * @param b Second job
+     * @return True if a is more urgent than b
+     */
+    static bool moreUrgent(const Job& a, const Job& b);
+
+    void siftUp(size_t index);
+    void siftDown(size_t index);
+    void swapNodes(size_t a, size_t b);
+};
+
+#endif // DISPATCH_QUEUE_H
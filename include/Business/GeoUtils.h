@@ -0,0 +1,31 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef GEO_UTILS_H
+#define GEO_UTILS_H
+
+/**
+ * @namespace GeoUtils
+ * @brief Geographic helper functions
+ */
+namespace GeoUtils {
+
+    /**
+     * @brief Mean Earth radius in kilometers
+     */
+    constexpr double EARTH_RADIUS_KM = 6371.0088;
+
+    /**
+     * @brief Great-circle distance between two points (haversine formula)
+     * @param lat1 Latitude of the first point in degrees
+     * @param lon1 Longitude of the first point in degrees
+     * @param lat2 Latitude of the second point in degrees
+     * @param lon2 Longitude of the second point in degrees
+     * @return Distance in kilometers
+     */
+    double haversineKm(double lat1, double lon1, double lat2, double lon2);
+
+} // namespace GeoUtils
+
+#endif // GEO_UTILS_H
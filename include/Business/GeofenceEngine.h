@@ -0,0 +1,141 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef GEOFENCE_ENGINE_H
+#define GEOFENCE_ENGINE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+/**
+ * @class GeofenceEngine
+ * @brief Circular fences around intervention sites, crossed by moving subjects
+ *
+ * Each fence is registered in every grid cell its circle overlaps, so a
+ * position is checked against the few fences of its own cell plus the
+ * fences the subject is already inside: O(1) per position however many
+ * fences exist. A subject leaves a fence only once it is past the radius
+ * times the exit margin, so GPS jitter at the edge does not produce a
+ * stream of arrivals and departures. Not thread-safe.
+ */
+class GeofenceEngine {
+public:
+    static constexpr double MAX_RADIUS_KM = 5.0; // Fences are sites, not regions
+    /**
+     * @brief A fence crossed by a subject
+     */
+    struct Transition {
+        int fenceId;
+        bool arrival; // False for a departure
+    };
+
+private:
+    struct Fence {
+        double latitude;
+        double longitude;
+        double radiusKm;
+        std::vector<std::uint64_t> cells;
+    };
+
+    double cellDegrees;
+    std::int64_t lonCellCount;
+    double exitMargin;
+    std::unordered_map<int, Fence> fences;
+    std::unordered_map<std::uint64_t, std::vector<int>> cells;   // Cell -> fences overlapping it
+    std::unordered_map<std::string, std::vector<int>> inside;    // Subject -> fences it is inside
+
+    /**
+     * @brief Key of the cell containing a point
+     * @param latIndex Latitude cell index
+     * @param lonIndex Longitude cell index (wrapped)
+     * @return Packed key
+     */
+    static std::uint64_t cellKey(std::int64_t latIndex, std::int64_t lonIndex);
+
+    /**
+     * @brief Key of the cell containing a point
+     * @param latitude Latitude
+     * @param longitude Longitude
+     * @return Packed key
+     */
+    std::uint64_t cellOf(double latitude, double longitude) const;
+
+    /**
+     * @brief Register a fence in the cells its exit circle overlaps
+     * @param fenceId ID of the fence
+     * @param fence The fence
+     */
+    void attach(int fenceId, Fence& fence);
+
+    /**
+     * @brief Unregister a fence from its cells
+     * @param fenceId ID of the fence
+     * @param fence The fence
+     */
+    void detach(int fenceId, Fence& fence);
+
+public:
+    /**
+     * @brief Constructor
+     * @param cellDegrees Size of a grid cell in degrees (0.01 is about 1.1 km)
+     */
+    explicit GeofenceEngine(double cellDegrees = 0.01);
+
+    /**
+     * @brief Create a fence or move/resize an existing one
+     * @param fenceId ID of the fence (the intervention ID)
+     * @param latitude Latitude of the center
+     * @param longitude Longitude of the center
+     * @param radiusKm Radius in kilometers
+     * @return True if the fence was set, false if the radius is not within (0, MAX_RADIUS_KM]
+     */
+    bool setFence(int fenceId, double latitude, double longitude, double radiusKm);
+
+    /**
+     * @brief Remove a fence; subjects inside it leave without a departure
+     * @param fenceId ID of the fence
+     * @return True if the fence existed
+     */
+    bool removeFence(int fenceId);
+
+    /**
+     * @brief Get the radius of a fence
+     * @param fenceId ID of the fence
+     * @return Radius in kilometers, or -1 if the fence does not exist
+     */
+    double getFenceRadius(int fenceId) const;
+
+    /**
+     * @brief Set how far past the radius a subject must go to leave
+     * @param margin Exit radius / entry radius (at least 1)
+     */
+    void setExitMargin(double margin);
+
+    /**
+     * @brief Record a new position of a subject
+     * @param subject ID of the subject (technician ID)
+     * @param latitude Latitude
+     * @param longitude Longitude
+     * @return The fences entered and left since the previous position
+     */
+    std::vector<Transition> update(const std::string& subject, double latitude, double longitude);
+
+    /**
+     * @brief Check whether a subject is inside a fence
+     * @param subject ID of the subject
+     * @param fenceId ID of the fence
+     * @return True if the subject's last position is inside the fence
+     */
+    bool isInside(const std::string& subject, int fenceId) const;
+
+    /**
+     * @brief Get the number of fences
+     * @return Number of fences
+     */
+    size_t getFenceCount() const;
+};
+
+#endif // GEOFENCE_ENGINE_H
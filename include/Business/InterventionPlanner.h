@@ -15,6 +15,19 @@
  * @brief Manages scheduling and planning of interventions
  */
 class InterventionPlanner {
+public:
+    static constexpr size_t MAX_INTERVENTIONS_PER_DAY = 10; // Arbitrary limit for demonstration
+
+    /**
+     * @brief An intervention to schedule in a batch
+     */
+    struct Booking {
+        int interventionId; // Set by scheduleInterventions() when it assigns the IDs
+        std::time_t date;
+        int duration;
+        bool scheduled; // Set by scheduleInterventions()
+    };
+
 private:
     std::map<std::time_t, std::vector<int>> dailyInterventions; // Maps date to list of intervention IDs
 
@@ -33,6 +46,18 @@ public:
      */
     bool scheduleIntervention(int interventionId, std::time_t date, int duration);
 
+    /**
+     * @brief Schedule many interventions at once
+     * @param bookings Interventions sorted by date; each one's scheduled flag is set
+     * @param nextId If not null, scheduled bookings get their ID from it, in order,
+     *               so refused ones use none
+     * @return Number of interventions scheduled (0 if the bookings are not sorted)
+     *
+     * Each day is looked up once for all its bookings instead of once per
+     * intervention. A booking is refused when its day is full.
+     */
+    size_t scheduleInterventions(std::vector<Booking>& bookings, int* nextId = nullptr);
+
     /**
      * @brief Reschedule an existing intervention
      * @param interventionId ID of the intervention to reschedule
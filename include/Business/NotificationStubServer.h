@@ -0,0 +1,80 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef NOTIFICATION_STUB_SERVER_H
+#define NOTIFICATION_STUB_SERVER_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <mutex>
+#include <chrono>
+
+/**
+ * @class NotificationStubServer
+ * @brief Local stand-in for the email (SMTP) and mobile push services
+ *
+ * Accepts notification batches the way a remote service would (one session
+ * per batch), simulates the network cost and records throughput and latency
+ * so the notification pipeline can be measured offline.
+ */
+class NotificationStubServer {
+public:
+    /**
+     * @brief Delivery statistics
+     */
+    struct Stats {
+        size_t sessions = 0;        // Number of batches (SMTP sessions / push requests)
+        size_t messages = 0;        // Number of messages delivered
+        double totalLatencyMs = 0;  // Cumulated time spent in sessions
+        double maxLatencyMs = 0;    // Slowest session
+    };
+
+private:
+    std::chrono::microseconds sessionLatency;
+    std::chrono::microseconds messageLatency;
+    bool keepMessages;
+    std::vector<std::pair<std::string, std::string>> received; // (recipient, message)
+    Stats stats;
+    mutable std::mutex mutex;
+
+public:
+    /**
+     * @brief Constructor
+     * @param sessionLatency Simulated cost of opening a session
+     * @param messageLatency Simulated cost of each message in a session
+     * @param keepMessages Whether to keep delivered messages for inspection
+     */
+    explicit NotificationStubServer(std::chrono::microseconds sessionLatency = std::chrono::microseconds(2000),
+                                    std::chrono::microseconds messageLatency = std::chrono::microseconds(50),
+                                    bool keepMessages = false);
+
+    /**
+     * @brief Deliver a batch of messages in a single session
+     * @param protocol Name of the simulated protocol ("SMTP", "PUSH")
+     * @param batch Vector of (recipient, message) pairs
+     * @return Number of messages accepted
+     */
+    size_t deliverBatch(const std::string& protocol,
+                        const std::vector<std::pair<std::string, std::string>>& batch);
+
+    /**
+     * @brief Get the delivery statistics
+     * @return Copy of the current statistics
+     */
+    Stats getStats() const;
+
+    /**
+     * @brief Get the delivered messages (only if keepMessages is enabled)
+     * @return Vector of (recipient, message) pairs
+     */
+    std::vector<std::pair<std::string, std::string>> getReceivedMessages() const;
+
+    /**
+     * @brief Reset statistics and received messages
+     */
+    void reset();
+};
+
+#endif // NOTIFICATION_STUB_SERVER_H
@@ -8,10 +8,39 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <deque>
+#include <array>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <shared_mutex>
+#include "Business/NotificationStubServer.h"
+#include "Business/TimerWheel.h"
 
 /**
  * @class NotificationSystem
  * @brief Handles sending notifications to different recipients
+ *
+ * Each channel owns a worker queue: notifications are enqueued by the caller,
+ * duplicates for the same recipient are coalesced within a time window, and
+ * each worker delivers its queue in batches (one log write, one SMTP session
+ * or one push request per batch). Channels are served in parallel.
+ *
+ * Technician and broadcast notifications are rate limited per recipient with
+ * a token bucket. Notifications exceeding the budget are merged into a digest
+ * delivered when the recipient's digest window closes, which bounds the load
+ * to O(recipients) per window during notification storms.
+ *
+ * Users are registered once as dense integer handles; their channel
+ * preferences are a bitmask in a flat table indexed by handle. Named
+ * recipient groups (region, specialty, on-call rota...) keep a precomputed
+ * membership list so notifying a group never scans every user.
  */
 class NotificationSystem {
 public:
@@ -25,12 +54,78 @@ public:
         MOBILE
     };
 
+    /**
+     * @brief Dense handle identifying a registered user
+     */
+    using UserHandle = std::uint32_t;
+
+    static constexpr UserHandle INVALID_USER = 0xFFFFFFFFu;
+
+    /**
+     * @brief Per-channel delivery statistics
+     */
+    struct ChannelStats {
+        size_t enqueued = 0;   // Notifications accepted in the queue
+        size_t coalesced = 0;  // Duplicates dropped within the coalescing window
+        size_t delivered = 0;  // Notifications actually sent
+        size_t batches = 0;    // Number of batches sent
+    };
+
 private:
-    std::map<std::string, std::vector<Channel>> userPreferences; // Maps user ID to preferred channels
-    bool consoleEnabled;
-    bool logEnabled;
+    static constexpr size_t CHANNEL_COUNT = 4;
+
+    struct PendingNotification {
+        std::string recipient;
+        std::string message;
+    };
+
+    struct RecipientBudget {
+        double tokens = 0;
+        std::time_t lastRefill = 0;
+        std::vector<std::string> digest;  // Messages held back for the next digest
+        TimerWheel::TimerId digestTimer = TimerWheel::INVALID_TIMER;
+    };
+
+    struct ChannelQueue {
+        std::deque<PendingNotification> pending;
+        std::unordered_set<std::string> recentMessages; // Sent within the coalescing window
+        std::deque<std::pair<std::chrono::steady_clock::time_point, std::string>> recentOrder; // Same keys, oldest first
+        ChannelStats stats;
+        bool busy = false;
+        mutable std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::condition_variable drained;
+        std::thread worker;
+    };
+
+    // User directory: handle -> ID / channel mask (0 = no preferences)
+    std::unordered_map<std::string, UserHandle> userHandles;
+    std::deque<std::string> userIds;          // Deque keeps references stable while registering
+    std::vector<std::uint8_t> channelMasks;
+    std::unordered_map<std::string, std::vector<UserHandle>> recipientGroups;
+    mutable std::shared_mutex directoryMutex; // Guards the user directory and the groups
+
+    std::atomic<bool> consoleEnabled; // Set by the caller, read by the channel workers
+    std::atomic<bool> logEnabled;
     std::string logFile;
 
+    std::array<ChannelQueue, CHANNEL_COUNT> queues;
+    std::shared_ptr<NotificationStubServer> stubServer; // Email/push endpoint (nullptr to simulate on console)
+    std::chrono::milliseconds batchWindow;
+    size_t maxBatchSize;
+    std::chrono::milliseconds coalescingWindow;
+    mutable std::mutex configMutex; // Guards logFile, stubServer and the batching settings
+    std::atomic<bool> stopping;
+
+    // Per-recipient rate limiting
+    bool rateLimitEnabled;
+    int burstSize;          // Notifications a recipient may receive back to back
+    double refillPerSecond; // Sustained notification rate per recipient
+    int digestWindow;       // Seconds before held-back notifications are summarized
+    std::vector<RecipientBudget> recipientBudgets; // Indexed by user handle
+    TimerWheel digestTimers;
+    std::mutex limiterMutex; // Guards the budgets and the digest timers
+
 public:
     /**
      * @brief Constructor
@@ -41,6 +136,14 @@ public:
     NotificationSystem(bool enableConsole = true, bool enableLog = false,
                      const std::string& logFile = "notifications.log");
 
+    /**
+     * @brief Destructor - delivers pending notifications and stops the workers
+     */
+    ~NotificationSystem();
+
+    NotificationSystem(const NotificationSystem&) = delete;
+    NotificationSystem& operator=(const NotificationSystem&) = delete;
+
     /**
      * @brief Set user notification preferences
      * @param userId ID of the user
@@ -48,14 +151,50 @@ public:
      */
     void setUserPreferences(const std::string& userId, const std::vector<Channel>& channels);
 
+    /**
+     * @brief Set user notification preferences as a channel bitmask
+     * @param user Handle of the user
+     * @param channelMask Bitmask built with channelBit()
+     */
+    void setUserPreferences(UserHandle user, std::uint8_t channelMask);
+
+    /**
+     * @brief Get the handle of a user, registering the user if needed
+     * @param userId ID of the user
+     * @return Handle of the user
+     */
+    UserHandle getUserHandle(const std::string& userId);
+
+    /**
+     * @brief Look up the handle of a registered user
+     * @param userId ID of the user
+     * @return Handle of the user, or INVALID_USER if not registered
+     */
+    UserHandle findUserHandle(const std::string& userId) const;
+
+    /**
+     * @brief Get the bit of a channel in a channel mask
+     * @param channel Channel
+     * @return Bit of the channel
+     */
+    static std::uint8_t channelBit(Channel channel);
+
     /**
      * @brief Send a notification to a specific user
      * @param userId ID of the recipient
      * @param message Notification message
-     * @return True if notification was sent successfully
+     * @return True if notification was queued on at least one channel
      */
     bool notifyUser(const std::string& userId, const std::string& message);
 
+    /**
+     * @brief Send a notification to a registered user
+     * @param user Handle of the recipient
+     * @param message Notification message
+     * @return True if notification was queued on at least one channel
+     */
+    bool notifyUser(UserHandle user, const std::string& message);
+
     /**
      * @brief Send a notification to a specific technician
      * @param technicianId ID of the technician
@@ -71,6 +210,44 @@ public:
      */
     int broadcastNotification(const std::string& message);
 
+    /**
+     * @brief Add a user to a named recipient group
+     * @param group Name of the group (e.g., "specialty:HVAC", "zone:3")
+     * @param userId ID of the user
+     * @return True if the user was added, false if already a member
+     */
+    bool addToGroup(const std::string& group, const std::string& userId);
+
+    /**
+     * @brief Remove a user from a named recipient group
+     * @param group Name of the group
+     * @param userId ID of the user
+     * @return True if the user was removed
+     */
+    bool removeFromGroup(const std::string& group, const std::string& userId);
+
+    /**
+     * @brief Replace the members of a named recipient group
+     * @param group Name of the group
+     * @param userIds IDs of the members
+     */
+    void defineGroup(const std::string& group, const std::vector<std::string>& userIds);
+
+    /**
+     * @brief Get the members of a named recipient group
+     * @param group Name of the group
+     * @return IDs of the members
+     */
+    std::vector<std::string> getGroupMembers(const std::string& group) const;
+
+    /**
+     * @brief Send a notification to every member of a group
+     * @param group Name of the group
+     * @param message Notification message
+     * @return Number of members notified
+     */
+    int notifyGroup(const std::string& group, const std::string& message);
+
     /**
      * @brief Enable or disable console notifications
      * @param enabled Whether to enable console notifications
@@ -84,32 +261,119 @@ public:
      */
     void setLogEnabled(bool enabled, const std::string& logFile = "");
 
+    /**
+     * @brief Route email and mobile notifications to a (stub) delivery server
+     * @param server Server to use, or nullptr to simulate on the console
+     */
+    void setStubServer(std::shared_ptr<NotificationStubServer> server);
+
+    /**
+     * @brief Configure batching
+     * @param window Time a worker waits for a batch to fill up
+     * @param maxSize Maximum number of notifications per batch
+     */
+    void setBatching(std::chrono::milliseconds window, size_t maxSize);
+
+    /**
+     * @brief Configure coalescing of duplicate notifications
+     * @param window Duplicates for the same recipient within this window are dropped (0 to disable)
+     */
+    void setCoalescingWindow(std::chrono::milliseconds window);
+
+    /**
+     * @brief Configure per-recipient rate limiting
+     * @param enabled Whether to rate limit technician and broadcast notifications
+     * @param burstSize Notifications a recipient may receive back to back
+     * @param perMinute Sustained notifications per minute per recipient
+     * @param digestWindowSeconds Seconds before held-back notifications are sent as a digest
+     */
+    void setRateLimit(bool enabled, int burstSize = 5, int perMinute = 10, int digestWindowSeconds = 60);
+
+    /**
+     * @brief Deliver the digests whose window has closed
+     * @param now Current time
+     * @return Number of digests delivered
+     */
+    size_t processDigests(std::time_t now = std::time(nullptr));
+
+    /**
+     * @brief Get the number of notifications currently held back for digests
+     * @return Number of held-back notifications
+     */
+    size_t getPendingDigestCount();
+
+    /**
+     * @brief Block until every queued notification has been delivered
+     */
+    void flush();
+
+    /**
+     * @brief Get delivery statistics for a channel
+     * @param channel Channel to inspect
+     * @return Copy of the channel statistics
+     */
+    ChannelStats getChannelStats(Channel channel) const;
+
 private:
     /**
-     * @brief Send notification to console
+     * @brief Send a notification to a user through the rate limiter
+     * @param user Handle of the recipient
      * @param message Notification message
+     * @return True if the notification was sent or held back for a digest
      */
-    void sendToConsole(const std::string& message);
+    bool notifyLimited(UserHandle user, const std::string& message);
 
     /**
-     * @brief Send notification to log
-     * @param message Notification message
+     * @brief Send the digest of a recipient (called with limiterMutex held)
+     * @param user Handle of the recipient
      */
-    void sendToLog(const std::string& message);
+    void deliverDigest(UserHandle user);
 
     /**
-     * @brief Send notification via email (simulation)
-     * @param recipient Email address
+     * @brief Queue a notification on a channel
+     * @param channel Channel to use
+     * @param recipient Recipient of the notification
      * @param message Notification message
+     * @return True if the notification was queued or coalesced with a pending one
      */
-    void sendToEmail(const std::string& recipient, const std::string& message);
+    bool enqueue(Channel channel, const std::string& recipient, const std::string& message);
 
     /**
-     * @brief Send notification to mobile device (simulation)
-     * @param recipient Mobile identifier
-     * @param message Notification message
+     * @brief Worker loop of a channel
+     * @param channel Channel served by the worker
+     */
+    void runChannelWorker(Channel channel);
+
+    /**
+     * @brief Deliver a batch on a channel
+     * @param channel Channel to use
+     * @param batch Notifications to deliver
+     */
+    void deliverBatch(Channel channel, const std::vector<PendingNotification>& batch);
+
+    /**
+     * @brief Send a batch of notifications to the console
+     * @param batch Notifications to display
+     */
+    void sendToConsole(const std::vector<PendingNotification>& batch);
+
+    /**
+     * @brief Send a batch of notifications to the log
+     * @param batch Notifications to write
+     */
+    void sendToLog(const std::vector<PendingNotification>& batch);
+
+    /**
+     * @brief Send a batch of notifications via email (one SMTP session)
+     * @param batch Notifications with email addresses as recipients
+     */
+    void sendToEmail(const std::vector<PendingNotification>& batch);
+
+    /**
+     * @brief Send a batch of notifications to mobile devices (one push request)
+     * @param batch Notifications with mobile identifiers as recipients
      */
-    void sendToMobile(const std::string& recipient, const std::string& message);
+    void sendToMobile(const std::vector<PendingNotification>& batch);
 };
 
-#endif // NOTIFICATION_SYSTEM_H
\ No newline at end of file
+#endif // NOTIFICATION_SYSTEM_H
@@ -0,0 +1,101 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef RECURRENCE_CACHE_H
+#define RECURRENCE_CACHE_H
+
+#include <list>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <ctime>
+#include "Business/RecurrenceEngine.h"
+
+/**
+ * @class RecurrenceCache
+ * @brief Least recently used cache of recurrence windows expanded for calendar queries
+ *
+ * A window is expanded once and served again while the engine's generation
+ * is unchanged; any change to a series or to its exceptions makes every
+ * window stale. Interventions built for the occurrences belong to their
+ * window and are freed when it is evicted or recomputed, so the capacity
+ * bounds the memory of the cache. Not thread-safe.
+ */
+class RecurrenceCache {
+private:
+    struct Window {
+        std::time_t from;
+        std::time_t to;
+        unsigned long generation;
+        std::vector<RecurrenceEngine::Occurrence> occurrences;
+        std::vector<std::unique_ptr<Intervention>> instances; // Built on first request
+        std::vector<const Intervention*> instanceViews;
+        bool instantiated;
+        std::map<int, int> dayCounts;                         // Built on first request
+        bool counted;
+    };
+
+    size_t capacity;
+    std::list<Window> windows; // Most recently used first
+    std::map<std::pair<std::time_t, std::time_t>, std::list<Window>::iterator> index;
+
+    /**
+     * @brief Find or expand a window, making it the most recently used
+     * @param engine The series
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @return The up-to-date window
+     */
+    Window& lookup(const RecurrenceEngine& engine, std::time_t from, std::time_t to);
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of windows kept
+     */
+    explicit RecurrenceCache(size_t capacity = 32);
+
+    /**
+     * @brief Get the pending occurrences of a window
+     * @param engine The series
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @return Occurrences sorted by date, valid until the next call
+     */
+    const std::vector<RecurrenceEngine::Occurrence>& getOccurrences(const RecurrenceEngine& engine,
+                                                                    std::time_t from, std::time_t to);
+
+    /**
+     * @brief Get the pending occurrences of a window as interventions
+     * @param engine The series
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @return Copies of the prototypes at the occurrence dates, with ID -1, valid until
+     *         the window is evicted or the series change
+     */
+    std::vector<const Intervention*> getInstances(const RecurrenceEngine& engine, std::time_t from, std::time_t to);
+
+    /**
+     * @brief Count the pending occurrences of a window per day of month
+     * @param engine The series
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @return Map of day of month (local time) to number of occurrences
+     */
+    const std::map<int, int>& getDayCounts(const RecurrenceEngine& engine, std::time_t from, std::time_t to);
+
+    /**
+     * @brief Drop every window and every intervention built for them
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of windows kept
+     * @return Number of windows
+     */
+    size_t size() const;
+};
+
+#endif // RECURRENCE_CACHE_H
@@ -0,0 +1,255 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef RECURRENCE_ENGINE_H
+#define RECURRENCE_ENGINE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ctime>
+#include "Model/Intervention.h"
+
+/**
+ * @struct RecurrenceRule
+ * @brief Repetition pattern of a series, a subset of the iCalendar RRULE
+ */
+struct RecurrenceRule {
+    enum class Frequency {
+        DAILY,
+        WEEKLY,
+        MONTHLY // Same day of month, clamped to the last day of shorter months
+    };
+
+    Frequency frequency = Frequency::WEEKLY;
+    int interval = 1;      // Periods between two occurrences
+    int count = 0;         // Number of occurrences, 0 for no limit
+    std::time_t until = 0; // Last possible date, 0 for no limit
+
+    /**
+     * @brief Parse a rule such as "FREQ=MONTHLY;INTERVAL=3;COUNT=8" or "FREQ=WEEKLY;UNTIL=2027-06-30"
+     * @param text The rule
+     * @param rule Receives the rule
+     * @return True if the rule is valid
+     */
+    static bool parse(const std::string& text, RecurrenceRule& rule);
+
+    /**
+     * @brief Format the rule in the syntax accepted by parse()
+     * @return The rule
+     */
+    std::string toString() const;
+};
+
+/**
+ * @class RecurrenceEngine
+ * @brief Recurring interventions stored as a prototype and a rule
+ *
+ * Occurrences are never stored up front: they are computed on demand for a
+ * date window, by jumping straight to the first index of the window. Only
+ * the occurrences that differ from the rule are stored, sparsely: cancelled,
+ * moved, or already materialized as real interventions. Occurrences whose
+ * date passed while still pending are counted as missed, behind a date per
+ * series, and are no longer pending. Not thread-safe.
+ */
+class RecurrenceEngine {
+public:
+    /**
+     * @brief An occurrence of a series still to be materialized
+     */
+    struct Occurrence {
+        int seriesId;
+        int index;        // 0 for the first occurrence of the series
+        std::time_t date; // Moved date if the occurrence was moved
+        int duration;
+    };
+
+private:
+    struct Exception {
+        enum class Kind { CANCELLED, MOVED, MATERIALIZED };
+        Kind kind;
+        std::time_t date;   // For MOVED
+        int interventionId; // For MATERIALIZED
+    };
+
+    struct Series {
+        std::unique_ptr<Intervention> prototype;
+        RecurrenceRule rule;
+        std::tm start;                         // Local time of the first occurrence
+        std::map<int, Exception> exceptions;   // Occurrence index -> exception
+        std::multimap<std::time_t, int> moved; // Moved date -> occurrence index, for window lookups
+        std::time_t missedBefore = 0;          // Occurrences still pending before it were missed
+        int missedCount = 0;
+    };
+
+    std::map<int, Series> series;
+    int nextSeriesId;
+    unsigned long generation; // Bumped by every change, to invalidate expansions
+
+    /**
+     * @brief Date of an occurrence, following the rule only
+     * @param entry The series
+     * @param index Index of the occurrence
+     * @return The date, or -1 if the rule ends before this index
+     */
+    static std::time_t occurrenceDate(const Series& entry, int index);
+
+    /**
+     * @brief Index of the first occurrence at or after a date
+     * @param entry The series
+     * @param date The date
+     * @param indexDate Receives the date of that occurrence, or -1 past the end of the rule
+     * @return The index
+     */
+    static int firstIndexFrom(const Series& entry, std::time_t date, std::time_t& indexDate);
+
+    /**
+     * @brief Append the pending occurrences of a series within a window
+     * @param seriesId ID of the series
+     * @param entry The series
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @param occurrences Receives the occurrences, unsorted
+     */
+    static void collect(int seriesId, const Series& entry, std::time_t from, std::time_t to,
+                        std::vector<Occurrence>& occurrences);
+
+    /**
+     * @brief Replace the exception of an occurrence
+     * @param entry The series
+     * @param index Index of the occurrence
+     * @param exception The new exception
+     */
+    static void setException(Series& entry, int index, const Exception& exception);
+
+    /**
+     * @brief Find a series and check that an occurrence index belongs to it
+     * @param seriesId ID of the series
+     * @param index Index of the occurrence
+     * @return The series, or nullptr if either is invalid
+     */
+    Series* findOccurrence(int seriesId, int index);
+
+public:
+    /**
+     * @brief Default constructor
+     */
+    RecurrenceEngine();
+
+    /**
+     * @brief Add a series
+     * @param prototype Intervention copied for each occurrence; its date is the first occurrence
+     * @param rule The repetition pattern
+     * @return ID of the series, or -1 if the prototype or the rule is invalid
+     */
+    int addSeries(std::unique_ptr<Intervention> prototype, const RecurrenceRule& rule);
+
+    /**
+     * @brief Remove a series and its exceptions
+     * @param seriesId ID of the series
+     * @return True if the series existed
+     */
+    bool removeSeries(int seriesId);
+
+    /**
+     * @brief Get the number of series
+     * @return Number of series
+     */
+    size_t getSeriesCount() const;
+
+    /**
+     * @brief Get the generation of the series
+     * @return A number that changes whenever a series or an exception changes
+     */
+    unsigned long getGeneration() const;
+
+    /**
+     * @brief Get the prototype of a series
+     * @param seriesId ID of the series
+     * @return The prototype, or nullptr if the series does not exist
+     */
+    const Intervention* getPrototype(int seriesId) const;
+
+    /**
+     * @brief Get the rule of a series
+     * @param seriesId ID of the series
+     * @return The rule, or nullptr if the series does not exist
+     */
+    const RecurrenceRule* getRule(int seriesId) const;
+
+    /**
+     * @brief Cancel an occurrence
+     * @param seriesId ID of the series
+     * @param index Index of the occurrence
+     * @return False if the series or the occurrence does not exist
+     */
+    bool cancelOccurrence(int seriesId, int index);
+
+    /**
+     * @brief Move an occurrence to another date
+     * @param seriesId ID of the series
+     * @param index Index of the occurrence
+     * @param date New date
+     * @return False if the series or the occurrence does not exist
+     */
+    bool moveOccurrence(int seriesId, int index, std::time_t date);
+
+    /**
+     * @brief Record that an occurrence became a real intervention
+     * @param seriesId ID of the series
+     * @param index Index of the occurrence
+     * @param interventionId ID of the intervention
+     * @return False if the series or the occurrence does not exist
+     */
+    bool markMaterialized(int seriesId, int index, int interventionId);
+
+    /**
+     * @brief Get the intervention an occurrence became
+     * @param seriesId ID of the series
+     * @param index Index of the occurrence
+     * @return ID of the intervention, or -1 if the occurrence is not materialized
+     */
+    int getMaterializedId(int seriesId, int index) const;
+
+    /**
+     * @brief Count the occurrences still pending before a date as missed
+     * @param date The date (usually now)
+     * @return Number of occurrences newly missed
+     */
+    size_t expireBefore(std::time_t date);
+
+    /**
+     * @brief Get the number of occurrences of a series that were missed
+     * @param seriesId ID of the series
+     * @return Number of missed occurrences, or -1 if the series does not exist
+     */
+    int getMissedCount(int seriesId) const;
+
+    /**
+     * @brief Get the pending occurrences of every series within a window
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @return Occurrences not cancelled nor materialized, sorted by date
+     */
+    std::vector<Occurrence> expand(std::time_t from, std::time_t to) const;
+
+    /**
+     * @brief Get the pending occurrences of one series within a window
+     * @param seriesId ID of the series
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @return Occurrences not cancelled nor materialized, sorted by date
+     */
+    std::vector<Occurrence> expandSeries(int seriesId, std::time_t from, std::time_t to) const;
+
+    /**
+     * @brief Create the intervention of an occurrence by copying the prototype
+     * @param occurrence The occurrence
+     * @return The intervention (without ID), or nullptr if the series does not exist
+     */
+    std::unique_ptr<Intervention> instantiate(const Occurrence& occurrence) const;
+};
+
+#endif // RECURRENCE_ENGINE_H
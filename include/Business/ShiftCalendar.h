@@ -0,0 +1,160 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef SHIFT_CALENDAR_H
+#define SHIFT_CALENDAR_H
+
+#include <map>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <ctime>
+
+/**
+ * @class ShiftCalendar
+ * @brief Working hours, on-call windows and holidays of one technician
+ *
+ * Time is cut into 15-minute buckets stored as bitmaps in 10-day pages
+ * (15 words per bitmap, 240 bytes per page for both bitmaps), so checking a
+ * window is a few 64-bit AND operations and a month touches at most four
+ * pages (960 bytes). Shifts and on-call windows only cover the buckets they
+ * fill entirely; holidays block every bucket they touch. Holidays clear both
+ * bitmaps and are remembered so that shifts added later do not overwrite
+ * them. Pages that were never touched mean "not working".
+ */
+class ShiftCalendar {
+public:
+    static constexpr std::time_t BUCKET_SECONDS = 15 * 60;
+
+    /**
+     * @brief Kind of calendar entry
+     */
+    enum class EntryKind {
+        SHIFT,    // Working hours
+        ON_CALL,  // Available for emergencies only
+        HOLIDAY   // Overrides shifts and on-call windows
+    };
+
+private:
+    static constexpr size_t WORDS_PER_PAGE = 15;                   // 10 days of 96 buckets
+    static constexpr std::int64_t BUCKETS_PER_PAGE = WORDS_PER_PAGE * 64;
+
+    struct Page {
+        std::array<std::uint64_t, WORDS_PER_PAGE> working{};
+        std::array<std::uint64_t, WORDS_PER_PAGE> onCall{};
+    };
+
+    std::map<std::int64_t, Page> pages;                          // Page index -> bitmaps
+    std::vector<std::pair<std::time_t, std::time_t>> holidays;   // [start, end) ranges
+
+    /**
+     * @brief Set or clear a range of buckets in one of the bitmaps
+     * @param firstBucket First bucket
+     * @param lastBucket One past the last bucket
+     * @param onCallMap True for the on-call bitmap, false for the working one
+     * @param value Value to write
+     */
+    void writeRange(std::int64_t firstBucket, std::int64_t lastBucket, bool onCallMap, bool value);
+
+    /**
+     * @brief Mark the buckets a range fills in a bitmap, leaving holidays untouched
+     * @param start Start of the range
+     * @param end End of the range
+     * @param onCallMap True for the on-call bitmap, false for the working one
+     */
+    void addRange(std::time_t start, std::time_t end, bool onCallMap);
+
+    /**
+     * @brief Find the first bucket that is not available in a range
+     * @param firstBucket First bucket
+     * @param lastBucket One past the last bucket
+     * @param includeOnCall Whether on-call buckets count as available
+     * @return The bucket, or lastBucket if the whole range is available
+     */
+    std::int64_t firstUnavailable(std::int64_t firstBucket, std::int64_t lastBucket, bool includeOnCall) const;
+
+    /**
+     * @brief Find the first available bucket in a range
+     * @param firstBucket First bucket
+     * @param lastBucket One past the last bucket
+     * @param includeOnCall Whether on-call buckets count as available
+     * @return The bucket, or lastBucket if none is available
+     */
+    std::int64_t firstAvailable(std::int64_t firstBucket, std::int64_t lastBucket, bool includeOnCall) const;
+
+public:
+    /**
+     * @brief Add working hours
+     * @param start Start of the shift
+     * @param end End of the shift
+     */
+    void addShift(std::time_t start, std::time_t end);
+
+    /**
+     * @brief Add an on-call window (available for emergencies only)
+     * @param start Start of the window
+     * @param end End of the window
+     */
+    void addOnCall(std::time_t start, std::time_t end);
+
+    /**
+     * @brief Add a holiday, overriding shifts and on-call windows
+     * @param start Start of the holiday
+     * @param end End of the holiday
+     */
+    void addHoliday(std::time_t start, std::time_t end);
+
+    /**
+     * @brief Add the same working hours on a weekday for a period
+     * @param weekday Day of the week (0 = Sunday)
+     * @param startMinute Start of the shift in minutes after local midnight
+     * @param endMinute End of the shift in minutes after local midnight
+     * @param from Start of the period
+     * @param to End of the period
+     * @param onCall True to add on-call windows instead of working hours
+     */
+    void addWeeklyShift(int weekday, int startMinute, int endMinute,
+                        std::time_t from, std::time_t to, bool onCall = false);
+
+    /**
+     * @brief Remove every shift, on-call window and holiday
+     */
+    void clear();
+
+    /**
+     * @brief Check if the whole window falls in working time
+     * @param start Start of the window
+     * @param duration Duration in minutes
+     * @param includeOnCall Whether on-call windows count as working time
+     * @return True if every bucket touched by the window is available
+     */
+    bool isAvailable(std::time_t start, int duration, bool includeOnCall = false) const;
+
+    /**
+     * @brief Find the earliest start of an available window
+     * @param from Earliest allowed start
+     * @param duration Duration in minutes
+     * @param limit Latest allowed end
+     * @param includeOnCall Whether on-call windows count as working time
+     * @return The start, or -1 if there is none before the limit
+     */
+    std::time_t nextAvailable(std::time_t from, int duration, std::time_t limit, bool includeOnCall = false) const;
+
+    /**
+     * @brief Count the working minutes in a period
+     * @param from Start of the period
+     * @param to End of the period
+     * @param includeOnCall Whether on-call windows count as working time
+     * @return Minutes, at 15-minute granularity
+     */
+    int getAvailableMinutes(std::time_t from, std::time_t to, bool includeOnCall = false) const;
+
+    /**
+     * @brief Get the memory used by the bitmaps
+     * @return Size in bytes
+     */
+    size_t getMemoryUsage() const;
+};
+
+#endif // SHIFT_CALENDAR_H
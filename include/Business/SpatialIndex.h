@@ -0,0 +1,362 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef SPATIAL_INDEX_H
+#define SPATIAL_INDEX_H
+
+#include "Business/GeoUtils.h"
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @class SpatialIndex
+ * @brief Grid of fixed-size latitude/longitude cells over keyed points
+ * @tparam Key Type identifying a point (intervention ID, technician ID...)
+ *
+ * Each point lives in the cell that contains it, so inserting, moving and
+ * removing a point are O(1) on average. Radius queries visit the cells
+ * overlapping the query's bounding box and compare chord lengths between
+ * unit vectors, which orders points like the great-circle distance without
+ * any trigonometry; nearest-neighbor queries run radius queries of doubling
+ * size.
+ * Longitudes wrap around the antimeridian. Not thread-safe.
+ */
+template <typename Key>
+class SpatialIndex {
+public:
+    /**
+     * @brief A query result
+     */
+    struct Match {
+        Key key;
+        double distanceKm;
+    };
+
+private:
+    struct Entry {
+        Key key;
+        double latitude;
+        double longitude;
+        double x, y, z; // Unit vector, compared by chord length
+        std::uint64_t cell;
+    };
+
+    double cellDegrees;
+    std::int64_t lonCellCount;
+    std::vector<Entry> entries;
+    std::unordered_map<Key, size_t> positions;                   // Key -> index in entries
+    std::unordered_map<std::uint64_t, std::vector<size_t>> cells; // Cell -> indexes in entries
+
+    std::int64_t latCell(double latitude) const {
+        return static_cast<std::int64_t>(std::floor((std::max(-90.0, std::min(90.0, latitude)) + 90.0) / cellDegrees));
+    }
+
+    std::int64_t lonCell(double longitude) const {
+        std::int64_t cell = static_cast<std::int64_t>(std::floor((longitude + 180.0) / cellDegrees));
+        return ((cell % lonCellCount) + lonCellCount) % lonCellCount;
+    }
+
+    static std::uint64_t cellKey(std::int64_t latIndex, std::int64_t lonIndex) {
+        return (static_cast<std::uint64_t>(latIndex) << 32) | static_cast<std::uint32_t>(lonIndex);
+    }
+
+    void detach(size_t index) {
+        auto cellIt = cells.find(entries[index].cell);
+        auto& members = cellIt->second;
+        members.erase(std::find(members.begin(), members.end(), index));
+        if (members.empty()) {
+            cells.erase(cellIt);
+        }
+    }
+
+    void attach(size_t index) {
+        cells[entries[index].cell].push_back(index);
+    }
+
+    static constexpr double PI = 3.14159265358979323846;
+
+    static void toUnitVector(double latitude, double longitude, double& x, double& y, double& z) {
+        double phi = latitude * PI / 180.0;
+        double lambda = longitude * PI / 180.0;
+        x = std::cos(phi) * std::cos(lambda);
+        y = std::cos(phi) * std::sin(lambda);
+        z = std::sin(phi);
+    }
+
+    /**
+     * @brief Squared chord between two unit vectors; monotonic in the great-circle distance
+     */
+    static double chordSquared(const Entry& entry, double x, double y, double z) {
+        double dx = entry.x - x;
+        double dy = entry.y - y;
+        double dz = entry.z - z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    static double chordToKm(double chordSq) {
+        return 2.0 * GeoUtils::EARTH_RADIUS_KM * std::asin(std::min(1.0, std::sqrt(chordSq) / 2.0));
+    }
+
+    static double kmToChordSquared(double km) {
+        double angle = std::min(PI, km / GeoUtils::EARTH_RADIUS_KM);
+        double chord = 2.0 * std::sin(angle / 2.0);
+        return chord * chord;
+    }
+
+    void collect(size_t index, double x, double y, double z, double limit, std::vector<Match>& out) const {
+        const Entry& entry = entries[index];
+        double chordSq = chordSquared(entry, x, y, z);
+        if (chordSq <= limit) {
+            out.push_back({entry.key, chordSq});
+        }
+    }
+
+    struct Box {
+        std::int64_t latFirst, latLast;
+        std::int64_t lonFirst, lonLast;
+        bool scanAll;
+    };
+
+    /**
+     * @brief Cells covering a circle; longitudes widen towards the poles
+     */
+    Box coverBox(double latitude, double longitude, double radiusKm) const {
+        double latSpan = radiusKm / GeoUtils::EARTH_RADIUS_KM * 180.0 / PI;
+        double maxLat = std::min(90.0, std::fabs(latitude) + latSpan);
+        double cosMaxLat = std::cos(maxLat * PI / 180.0);
+        bool allLongitudes = cosMaxLat < 1e-9 || latSpan / cosMaxLat >= 180.0;
+        double lonSpan = allLongitudes ? 180.0 : latSpan / cosMaxLat;
+
+        Box box;
+        box.latFirst = latCell(latitude - latSpan);
+        box.latLast = latCell(latitude + latSpan);
+        box.lonFirst = allLongitudes ? 0 : static_cast<std::int64_t>(std::floor((longitude - lonSpan + 180.0) / cellDegrees));
+        box.lonLast = allLongitudes ? lonCellCount - 1 : static_cast<std::int64_t>(std::floor((longitude + lonSpan + 180.0) / cellDegrees));
+        box.lonLast = std::min(box.lonLast, box.lonFirst + lonCellCount - 1);
+
+        // A box with more cells than there are occupied ones is cheaper to
+        // replace by a scan over all the points
+        double cellCount = static_cast<double>(box.latLast - box.latFirst + 1) * static_cast<double>(box.lonLast - box.lonFirst + 1);
+        box.scanAll = cellCount > static_cast<double>(cells.size());
+        return box;
+    }
+
+    /**
+     * @brief Collect the points of a box within a squared chord; distanceKm holds the squared chord
+     */
+    void gather(const Box& box, double latitude, double longitude, double limit, std::vector<Match>& out) const {
+        double x, y, z;
+        toUnitVector(latitude, longitude, x, y, z);
+
+        if (box.scanAll) {
+            for (size_t index = 0; index < entries.size(); ++index) {
+                collect(index, x, y, z, limit, out);
+            }
+            return;
+        }
+
+        for (std::int64_t latIndex = box.latFirst; latIndex <= box.latLast; ++latIndex) {
+            for (std::int64_t lonIndex = box.lonFirst; lonIndex <= box.lonLast; ++lonIndex) {
+                std::int64_t wrapped = ((lonIndex % lonCellCount) + lonCellCount) % lonCellCount;
+                auto cellIt = cells.find(cellKey(latIndex, wrapped));
+                if (cellIt == cells.end()) {
+                    continue;
+                }
+                for (size_t index : cellIt->second) {
+                    collect(index, x, y, z, limit, out);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Keep the count nearest gathered points, sorted, with distances in kilometers
+     */
+    static void finish(std::vector<Match>& matches, size_t count) {
+        auto closer = [](const Match& a, const Match& b) { return a.distanceKm < b.distanceKm; };
+        if (count < matches.size()) {
+            std::partial_sort(matches.begin(), matches.begin() + static_cast<std::ptrdiff_t>(count), matches.end(), closer);
+            matches.resize(count);
+        } else {
+            std::sort(matches.begin(), matches.end(), closer);
+        }
+        for (Match& match : matches) {
+            match.distanceKm = chordToKm(match.distanceKm);
+        }
+    }
+
+    /**
+     * @brief Nearest points by a scan keeping the best ones in a bounded max-heap
+     */
+    std::vector<Match> nearestByScan(double latitude, double longitude, size_t count) const {
+        double x, y, z;
+        toUnitVector(latitude, longitude, x, y, z);
+
+        auto closer = [](const Match& a, const Match& b) { return a.distanceKm < b.distanceKm; };
+        std::vector<Match> heap;
+        heap.reserve(std::min(count, entries.size()) + 1);
+        for (const Entry& entry : entries) {
+            double chordSq = chordSquared(entry, x, y, z);
+            if (heap.size() < count) {
+                heap.push_back({entry.key, chordSq});
+                std::push_heap(heap.begin(), heap.end(), closer);
+            } else if (chordSq < heap.front().distanceKm) {
+                std::pop_heap(heap.begin(), heap.end(), closer);
+                heap.back() = {entry.key, chordSq};
+                std::push_heap(heap.begin(), heap.end(), closer);
+            }
+        }
+        finish(heap, heap.size());
+        return heap;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param cellDegrees Size of a cell in degrees (0.01 is about 1.1 km)
+     */
+    explicit SpatialIndex(double cellDegrees = 0.01)
+        : cellDegrees(cellDegrees > 0 ? cellDegrees : 0.01),
+          lonCellCount(static_cast<std::int64_t>(std::ceil(360.0 / this->cellDegrees))) {}
+
+    /**
+     * @brief Insert a point or move it if the key is already indexed
+     * @param key Key of the point
+     * @param latitude Latitude in degrees
+     * @param longitude Longitude in degrees
+     */
+    void update(const Key& key, double latitude, double longitude) {
+        std::uint64_t cell = cellKey(latCell(latitude), lonCell(longitude));
+        double x, y, z;
+        toUnitVector(latitude, longitude, x, y, z);
+
+        auto it = positions.find(key);
+        if (it == positions.end()) {
+            positions.emplace(key, entries.size());
+            entries.push_back({key, latitude, longitude, x, y, z, cell});
+            attach(entries.size() - 1);
+            return;
+        }
+
+        Entry& entry = entries[it->second];
+        entry.latitude = latitude;
+        entry.longitude = longitude;
+        entry.x = x;
+        entry.y = y;
+        entry.z = z;
+        if (entry.cell != cell) {
+            detach(it->second);
+            entry.cell = cell;
+            attach(it->second);
+        }
+    }
+
+    /**
+     * @brief Remove a point
+     * @param key Key of the point
+     * @return True if the key was indexed
+     */
+    bool remove(const Key& key) {
+        auto it = positions.find(key);
+        if (it == positions.end()) {
+            return false;
+        }
+
+        // Move the last entry into the freed slot
+        size_t index = it->second;
+        size_t last = entries.size() - 1;
+        detach(index);
+        positions.erase(it);
+
+        if (index != last) {
+            auto& members = cells[entries[last].cell];
+            *std::find(members.begin(), members.end(), last) = index;
+            entries[index] = std::move(entries[last]);
+            positions[entries[index].key] = index;
+        }
+        entries.pop_back();
+        return true;
+    }
+
+    /**
+     * @brief Get the position of a point
+     * @param key Key of the point
+     * @param latitude Receives the latitude
+     * @param longitude Receives the longitude
+     * @return True if the key is indexed
+     */
+    bool getPosition(const Key& key, double& latitude, double& longitude) const {
+        auto it = positions.find(key);
+        if (it == positions.end()) {
+            return false;
+        }
+
+        latitude = entries[it->second].latitude;
+        longitude = entries[it->second].longitude;
+        return true;
+    }
+
+    /**
+     * @brief Get the number of indexed points
+     * @return Number of points
+     */
+    size_t size() const {
+        return entries.size();
+    }
+
+    /**
+     * @brief Find the points within a radius
+     * @param latitude Latitude of the center
+     * @param longitude Longitude of the center
+     * @param radiusKm Radius in kilometers
+     * @return Matching points, nearest first
+     */
+    std::vector<Match> withinRadius(double latitude, double longitude, double radiusKm) const {
+        std::vector<Match> matches;
+        if (radiusKm < 0 || entries.empty()) {
+            return matches;
+        }
+
+        gather(coverBox(latitude, longitude, radiusKm), latitude, longitude, kmToChordSquared(radiusKm), matches);
+        finish(matches, matches.size());
+        return matches;
+    }
+
+    /**
+     * @brief Find the nearest points
+     * @param latitude Latitude of the center
+     * @param longitude Longitude of the center
+     * @param count Number of points wanted
+     * @return Up to count points, nearest first
+     */
+    std::vector<Match> nearest(double latitude, double longitude, size_t count) const {
+        std::vector<Match> matches;
+        if (count == 0 || entries.empty()) {
+            return matches;
+        }
+
+        // Every point within the radius is found, so once count of them are
+        // in it they are the nearest ones. Once the box outgrows the points,
+        // a single scan over all of them settles it.
+        double radiusKm = cellDegrees * 111.0;
+        for (;;) {
+            Box box = coverBox(latitude, longitude, radiusKm);
+            matches.clear();
+            if (box.scanAll) {
+                return nearestByScan(latitude, longitude, count);
+            }
+            gather(box, latitude, longitude, kmToChordSquared(radiusKm), matches);
+            if (matches.size() >= count) {
+                finish(matches, count);
+                return matches;
+            }
+            radiusKm *= 2;
+        }
+    }
+};
+
+#endif // SPATIAL_INDEX_H
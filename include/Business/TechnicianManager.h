@@ -10,15 +10,28 @@
 #include <string>
 #include <ctime>
 #include "Model/Technician.h"
+#include "Business/ShiftCalendar.h"
 
 /**
  * @class TechnicianManager
  * @brief Manages technicians and their availability
+ *
+ * Technicians without a shift calendar are available around the clock.
  */
 class TechnicianManager {
+public:
+    /**
+     * @brief A free time slot offered by a technician
+     */
+    struct SlotOption {
+        std::time_t start;        // Earliest start of the slot
+        std::string technicianId; // Technician free at that time
+    };
+
 private:
     std::map<std::string, Technician> technicians; // Maps ID to technician
     std::map<std::string, std::map<std::time_t, int>> assignments; // Technician ID -> (date -> duration)
+    std::map<std::string, ShiftCalendar> calendars; // Technician ID -> shifts, on-call windows and holidays
 
 public:
     /**
@@ -53,23 +66,60 @@ public:
      */
     const std::map<std::string, Technician>& getAllTechnicians() const;
 
+    /**
+     * @brief Get the shift calendar of a technician, creating it if needed
+     * @param technicianId ID of the technician
+     * @return Pointer to the calendar or nullptr if the technician does not exist
+     * @note Once a calendar exists the technician only works during its shifts
+     */
+    ShiftCalendar* getShiftCalendar(const std::string& technicianId);
+
+    /**
+     * @brief Get the shift calendar of a technician
+     * @param technicianId ID of the technician
+     * @return Pointer to the calendar or nullptr if the technician works around the clock
+     */
+    const ShiftCalendar* findShiftCalendar(const std::string& technicianId) const;
+
+    /**
+     * @brief Remove the shift calendar of a technician
+     * @param technicianId ID of the technician
+     * @return True if the technician had a calendar
+     */
+    bool removeShiftCalendar(const std::string& technicianId);
+
+    /**
+     * @brief Check if a time window falls within a technician's shifts
+     * @param technicianId ID of the technician
+     * @param date Start of the window
+     * @param duration Duration in minutes
+     * @param includeOnCall Whether on-call windows count (emergencies)
+     * @return True if the technician works during the whole window
+     */
+    bool isOnShift(const std::string& technicianId, std::time_t date, int duration,
+                   bool includeOnCall = false) const;
+
     /**
      * @brief Check if a technician is available at a specific time
      * @param technicianId ID of the technician
      * @param date Date and time to check
      * @param duration Duration in minutes
+     * @param includeOnCall Whether on-call windows count (emergencies)
      * @return True if technician is available
      */
-    bool isTechnicianAvailable(const std::string& technicianId, std::time_t date, int duration) const;
+    bool isTechnicianAvailable(const std::string& technicianId, std::time_t date, int duration,
+                               bool includeOnCall = false) const;
 
     /**
      * @brief Assign a technician to an intervention
      * @param technicianId ID of the technician
      * @param date Date and time of the intervention
      * @param duration Duration in minutes
+     * @param includeOnCall Whether on-call windows count (emergencies)
      * @return True if assignment was successful
      */
-    bool assignTechnician(const std::string& technicianId, std::time_t date, int duration);
+    bool assignTechnician(const std::string& technicianId, std::time_t date, int duration,
+                          bool includeOnCall = false);
 
     /**
      * @brief Unassign a technician from an intervention
@@ -79,15 +129,47 @@ public:
      */
     bool unassignTechnician(const std::string& technicianId, std::time_t date);
 
+    /**
+     * @brief Get the assignments of a technician overlapping a time window
+     * @param technicianId ID of the technician
+     * @param date Start of the window
+     * @param duration Duration in minutes
+     * @return (date, duration) of each overlapping assignment, in date order
+     *
+     * A technician's assignments never overlap, so only the assignments
+     * around the window are visited: O(log A + overlaps).
+     */
+    std::vector<std::pair<std::time_t, int>> getOverlappingAssignments(const std::string& technicianId,
+                                                                       std::time_t date, int duration) const;
+
     /**
      * @brief Find available technicians for a time slot
      * @param date Date and time of the intervention
      * @param duration Duration in minutes
      * @param specialty Optional specialty requirement
+     * @param includeOnCall Whether on-call windows count (emergencies)
      * @return Vector of available technician IDs
      */
     std::vector<std::string> findAvailableTechnicians(std::time_t date, int duration,
-                                                    const std::string& specialty = "") const;
+                                                    const std::string& specialty = "",
+                                                    bool includeOnCall = false) const;
+
+    /**
+     * @brief Find the earliest free slots across technicians
+     * @param duration Duration of the slot in minutes
+     * @param specialty Optional specialty requirement
+     * @param notBefore Earliest allowed start
+     * @param horizon Latest allowed end
+     * @param count Maximum number of options to return
+     * @param includeOnCall Whether on-call windows count (emergencies)
+     * @return Up to count options, one per technician, earliest first
+     *
+     * Sweeps the busy intervals of all eligible technicians at once with a
+     * heap, so the cost is O(A log T) for A assignments in the horizon.
+     */
+    std::vector<SlotOption> findEarliestSlots(int duration, const std::string& specialty,
+                                              std::time_t notBefore, std::time_t horizon,
+                                              size_t count = 1, bool includeOnCall = false) const;
 };
 
 #endif // TECHNICIAN_MANAGER_H
\ No newline at end of file
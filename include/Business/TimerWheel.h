@@ -0,0 +1,120 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <ctime>
+
+/**
+ * @class TimerWheel
+ * @brief Hierarchical timing wheel with one-second resolution
+ *
+ * Four levels of 256 slots cover 2^32 seconds: level 0 holds timers due in
+ * the next 256 seconds, and each upper level is cascaded into the level
+ * below when the lower one wraps. Timers live in intrusive lists over a node
+ * slab, so scheduling and cancelling are O(1) and millions of pending timers
+ * cost a few dozen bytes each.
+ * The wheel is not thread-safe; callers serialize access.
+ */
+class TimerWheel {
+public:
+    using TimerId = std::uint64_t;
+    using Callback = std::function<void()>;
+
+    static constexpr TimerId INVALID_TIMER = 0;
+
+private:
+    static constexpr std::uint32_t NIL = 0xFFFFFFFFu;
+    static constexpr unsigned LEVEL_BITS = 8;
+    static constexpr unsigned SLOTS_PER_LEVEL = 1u << LEVEL_BITS;
+    static constexpr unsigned LEVEL_COUNT = 4;
+
+    struct Node {
+        std::time_t deadline = 0;
+        Callback callback;
+        std::uint32_t prev = NIL;
+        std::uint32_t next = NIL;
+        std::uint32_t slot = NIL;       // Index in the flattened slot table, NIL when the node is free
+        std::uint32_t generation = 1;   // Invalidates stale timer IDs
+    };
+
+    std::vector<Node> nodes;
+    std::vector<std::uint32_t> freeNodes;
+    std::vector<std::uint32_t> slots;   // Head node of each slot, level by level
+    std::time_t currentTime;
+    size_t activeCount;
+
+public:
+    /**
+     * @brief Constructor
+     * @param startTime Time the wheel starts at
+     */
+    explicit TimerWheel(std::time_t startTime = std::time(nullptr));
+
+    /**
+     * @brief Schedule a callback
+     * @param deadline Time at which the callback should fire
+     * @param callback Function to call
+     * @return ID of the timer, usable with cancel()
+     */
+    TimerId schedule(std::time_t deadline, Callback callback);
+
+    /**
+     * @brief Cancel a pending timer
+     * @param timerId ID returned by schedule()
+     * @return True if the timer was pending and is now cancelled
+     */
+    bool cancel(TimerId timerId);
+
+    /**
+     * @brief Advance the wheel and fire every timer due up to the given time
+     * @param now Current time
+     * @return Number of callbacks fired
+     */
+    size_t advance(std::time_t now);
+
+    /**
+     * @brief Get the number of pending timers
+     * @return Number of pending timers
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the time the wheel has been advanced to
+     * @return Current wheel time
+     */
+    std::time_t getCurrentTime() const;
+
+private:
+    /**
+     * @brief Link a node into the level and slot matching its deadline
+     * @param index Index of the node
+     */
+    void link(std::uint32_t index);
+
+    /**
+     * @brief Move the timers of an upper-level slot down the hierarchy
+     * @param level Level of the slot
+     * @param slot Slot within the level
+     */
+    void cascade(unsigned level, unsigned slot);
+
+    /**
+     * @brief Unlink a node from its slot
+     * @param index Index of the node
+     */
+    void unlink(std::uint32_t index);
+
+    /**
+     * @brief Return a node to the free list
+     * @param index Index of the node
+     */
+    void release(std::uint32_t index);
+};
+
+#endif // TIMER_WHEEL_H
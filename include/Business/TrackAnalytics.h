@@ -0,0 +1,123 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef TRACK_ANALYTICS_H
+#define TRACK_ANALYTICS_H
+
+#include "Business/CompressedTrack.h"
+#include <vector>
+#include <cstdint>
+#include <ctime>
+
+/**
+ * @class TrackAnalytics
+ * @brief Distance, speed and dwell analytics over a GPS track
+ *
+ * The track is copied once into a structure-of-arrays (radians, cosine of
+ * the latitude, timestamps). Haversine distances are then computed four
+ * points at a time with AVX2 when the CPU supports it, using polynomial
+ * sine and arcsine; the scalar path is the reference implementation and is
+ * used on other CPUs and compilers.
+ */
+class TrackAnalytics {
+public:
+    /**
+     * @brief Analytics of a whole track
+     */
+    struct Summary {
+        size_t points = 0;
+        double totalDistanceKm = 0;
+        std::time_t durationSeconds = 0;
+        double averageSpeedKmh = 0;
+        double maxSpeedKmh = 0;
+        bool hasSite = false;              // Site fields below are only set when true
+        double distanceToSiteKm = -1;      // From the last point
+        double closestApproachKm = -1;
+        std::time_t dwellSeconds = 0;      // Time spent within the site radius
+    };
+
+private:
+    std::vector<double> latitudes;     // Radians
+    std::vector<double> longitudes;    // Radians
+    std::vector<double> cosLatitudes;
+    std::vector<std::int64_t> timestamps;
+    std::vector<double> segmentKm;     // Distance between point i and i + 1
+    bool useAvx2;
+
+    /**
+     * @brief Distances from every point to a fixed location
+     * @param latitude Latitude in degrees
+     * @param longitude Longitude in degrees
+     * @return Distance in kilometers per point
+     */
+    std::vector<double> distancesTo(double latitude, double longitude) const;
+
+public:
+    /**
+     * @brief Build the analytics for a track
+     * @param track GPS points in chronological order
+     * @param allowSimd Use AVX2 kernels when the CPU supports them
+     */
+    explicit TrackAnalytics(const std::vector<TrackPoint>& track, bool allowSimd = true);
+
+    /**
+     * @brief Check if the AVX2 kernels can run on this CPU
+     * @return True if AVX2 and FMA are available
+     */
+    static bool isAvx2Supported();
+
+    /**
+     * @brief Check if this instance runs the AVX2 kernels
+     * @return True if vectorized
+     */
+    bool isVectorized() const;
+
+    /**
+     * @brief Total distance traveled along the track
+     * @return Distance in kilometers
+     */
+    double getTotalDistanceKm() const;
+
+    /**
+     * @brief Highest speed between two consecutive points
+     * @return Speed in km/h
+     */
+    double getMaxSpeedKmh() const;
+
+    /**
+     * @brief Average speed over the track
+     * @return Speed in km/h
+     */
+    double getAverageSpeedKmh() const;
+
+    /**
+     * @brief Distance from the last point to a site
+     * @param latitude Latitude of the site in degrees
+     * @param longitude Longitude of the site in degrees
+     * @return Distance in kilometers, or -1 if the track is empty
+     */
+    double getDistanceToSiteKm(double latitude, double longitude) const;
+
+    /**
+     * @brief Time spent within a radius of a site
+     * @param latitude Latitude of the site in degrees
+     * @param longitude Longitude of the site in degrees
+     * @param radiusKm Radius in kilometers
+     * @return Seconds between consecutive points that are both within the radius
+     */
+    std::time_t getDwellSeconds(double latitude, double longitude, double radiusKm) const;
+
+    /**
+     * @brief Compute every metric at once
+     * @param hasSite Whether the site coordinates are known
+     * @param siteLatitude Latitude of the site in degrees
+     * @param siteLongitude Longitude of the site in degrees
+     * @param siteRadiusKm Radius counted as "on site"
+     * @return The summary
+     */
+    Summary summarize(bool hasSite = false, double siteLatitude = 0, double siteLongitude = 0,
+                      double siteRadiusKm = 0.1) const;
+};
+
+#endif // TRACK_ANALYTICS_H
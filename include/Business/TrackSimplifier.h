@@ -0,0 +1,167 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef TRACK_SIMPLIFIER_H
+#define TRACK_SIMPLIFIER_H
+
+#include "Business/CompressedTrack.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class TrackSimplifier
+ * @brief Levels of detail of a GPS track, maintained as points are appended
+ *
+ * Three reduced levels are kept:
+ * - a Douglas-Peucker simplification at a distance tolerance, run on each
+ *   chunk of CHUNK_SIZE new points anchored on the last kept point;
+ * - the last fix of every minute;
+ * - the last fix of every hour.
+ * getWithBudget() picks the smallest level holding at least the budget and
+ * samples it down, so a query costs O(budget) whatever the track length.
+ * Levels store points like CompressedTrack, in fixed point (1e-7 degree),
+ * with seconds relative to the first fix: 12 bytes per point.
+ */
+class TrackSimplifier {
+public:
+    static constexpr size_t CHUNK_SIZE = 256;
+
+private:
+    // Point of a level in storage units
+    struct StoredPoint {
+        std::int32_t latitude;
+        std::int32_t longitude;
+        std::int32_t offset; // Seconds since the first fix
+    };
+
+    double toleranceMeters;
+    std::time_t origin;                    // Time of the first fix
+    std::vector<StoredPoint> simplified;   // Douglas-Peucker output up to the anchor
+    std::vector<StoredPoint> pending;      // Points after the anchor, not simplified yet
+    std::vector<StoredPoint> minuteLevel;
+    std::vector<StoredPoint> hourLevel;
+    size_t pointCount;
+
+    /**
+     * @brief Convert a point to storage units
+     * @param point The point
+     * @return The stored point
+     */
+    StoredPoint store(const TrackPoint& point) const;
+
+    /**
+     * @brief Convert a stored point back to degrees
+     * @param point The stored point
+     * @return The point
+     */
+    TrackPoint load(const StoredPoint& point) const;
+
+    /**
+     * @brief Simplify the pending chunk and move it to the simplified level
+     */
+    void simplifyPending();
+
+    /**
+     * @brief Keep the last fix of each period in a level
+     * @param level The level
+     * @param point The new point
+     * @param periodSeconds Length of a period
+     */
+    void addToLevel(std::vector<StoredPoint>& level, const StoredPoint& point, std::time_t periodSeconds) const;
+
+    /**
+     * @brief Evenly sample a level down to a budget, keeping both ends
+     * @param level The level
+     * @param rest Points following the level (may be empty)
+     * @param budget Maximum number of points
+     * @return The sampled points, decoded
+     */
+    std::vector<TrackPoint> sample(const std::vector<StoredPoint>& level, const std::vector<StoredPoint>& rest,
+                                   size_t budget) const;
+
+    /**
+     * @brief Decode a level
+     * @param level The level
+     * @return The points
+     */
+    std::vector<TrackPoint> loadAll(const std::vector<StoredPoint>& level) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @param toleranceMeters Douglas-Peucker distance tolerance
+     */
+    explicit TrackSimplifier(double toleranceMeters = 10.0);
+
+    /**
+     * @brief Add a point at the end of the track
+     * @param point The point
+     */
+    void add(const TrackPoint& point);
+
+    /**
+     * @brief Remove every point
+     */
+    void clear();
+
+    /**
+     * @brief Get the Douglas-Peucker tolerance
+     * @return Tolerance in meters
+     */
+    double getTolerance() const;
+
+    /**
+     * @brief Set the Douglas-Peucker tolerance
+     * @param meters Tolerance in meters
+     * @note Only applies to points added afterwards; re-add the track to rebuild
+     */
+    void setTolerance(double meters);
+
+    /**
+     * @brief Get the number of points added
+     * @return Number of points
+     */
+    size_t getPointCount() const;
+
+    /**
+     * @brief Get the Douglas-Peucker level
+     * @return The simplified track
+     */
+    std::vector<TrackPoint> getSimplified() const;
+
+    /**
+     * @brief Get the per-minute level
+     * @return Last fix of every minute
+     */
+    std::vector<TrackPoint> getMinuteLevel() const;
+
+    /**
+     * @brief Get the per-hour level
+     * @return Last fix of every hour
+     */
+    std::vector<TrackPoint> getHourLevel() const;
+
+    /**
+     * @brief Get the memory used by the levels
+     * @return Size in bytes
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * @brief Get a reduced track within a point budget
+     * @param budget Maximum number of points
+     * @return At most budget points, first and last fixes included
+     */
+    std::vector<TrackPoint> getWithBudget(size_t budget) const;
+
+    /**
+     * @brief Douglas-Peucker simplification
+     * @param points The track
+     * @param toleranceMeters Maximum distance of a dropped point to the simplified line
+     * @return The simplified track
+     */
+    static std::vector<TrackPoint> douglasPeucker(const std::vector<TrackPoint>& points, double toleranceMeters);
+};
+
+#endif // TRACK_SIMPLIFIER_H
@@ -0,0 +1,196 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef TRAVEL_TIME_SERVICE_H
+#define TRAVEL_TIME_SERVICE_H
+
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+
+/**
+ * @class TravelTimeService
+ * @brief Shared cache of travel times between intervention locations
+ *
+ * Location strings are interned once into dense IDs. Their coordinates are
+ * kept as structure-of-arrays together with precomputed sines and cosines,
+ * so a batch of haversine distances reduces to a multiply-add loop the
+ * compiler vectorizes. Pairwise results are kept in a bounded LRU keyed by
+ * the packed ID pair. Each location carries a version: moving a location
+ * bumps it, and stale cache entries are dropped lazily when next read.
+ * All methods are thread-safe.
+ */
+class TravelTimeService {
+public:
+    using LocationId = std::uint32_t;
+    static constexpr LocationId INVALID_LOCATION = 0xFFFFFFFFu;
+
+private:
+    struct CacheEntry {
+        std::uint64_t key;
+        std::uint32_t fromVersion;
+        std::uint32_t toVersion;
+        double minutes;
+    };
+
+    // Interned locations
+    std::unordered_map<std::string, LocationId> locationIds;
+    std::vector<std::string> locationNames;
+
+    // Coordinates as structure-of-arrays (radians and precomputed trigonometry)
+    std::vector<double> sinLat, cosLat, sinLon, cosLon;
+    std::vector<std::uint32_t> versions;   // 0 while the coordinates are unknown
+
+    // Pairwise cache, most recently used first
+    std::list<CacheEntry> lruList;
+    std::unordered_map<std::uint64_t, std::list<CacheEntry>::iterator> cacheIndex;
+    size_t cacheCapacity;
+    size_t cacheHits;
+    size_t cacheMisses;
+
+    double roadFactor;        // Road distance / great-circle distance
+    double averageSpeedKmh;
+
+    mutable std::mutex mutex;
+
+    /**
+     * @brief Intern a location (caller holds the mutex)
+     * @param location Location string
+     * @return ID of the location
+     */
+    LocationId internLocked(const std::string& location);
+
+    /**
+     * @brief Travel time from the coordinates (caller holds the mutex)
+     * @param from Origin
+     * @param to Destination
+     * @return Travel time in minutes
+     */
+    double computeMinutes(LocationId from, LocationId to) const;
+
+    /**
+     * @brief Look up a pair in the cache (caller holds the mutex)
+     * @param from Origin
+     * @param to Destination
+     * @param minutes Receives the cached travel time
+     * @return True if a fresh entry was found
+     */
+    bool lookupLocked(LocationId from, LocationId to, double& minutes);
+
+    /**
+     * @brief Store a pair in the cache (caller holds the mutex)
+     * @param from Origin
+     * @param to Destination
+     * @param minutes Travel time in minutes
+     */
+    void storeLocked(LocationId from, LocationId to, double minutes);
+
+public:
+    /**
+     * @brief Constructor
+     * @param cacheCapacity Maximum number of cached pairs
+     * @param roadFactor Ratio between road distance and great-circle distance
+     * @param averageSpeedKmh Average travel speed
+     */
+    explicit TravelTimeService(size_t cacheCapacity = 65536, double roadFactor = 1.3,
+                               double averageSpeedKmh = 50.0);
+
+    TravelTimeService(const TravelTimeService&) = delete;
+    TravelTimeService& operator=(const TravelTimeService&) = delete;
+
+    /**
+     * @brief Get the ID of a location, interning it if needed
+     * @param location Location string
+     * @return ID of the location
+     */
+    LocationId intern(const std::string& location);
+
+    /**
+     * @brief Get the ID of a location without interning it
+     * @param location Location string
+     * @return ID of the location, or INVALID_LOCATION if unknown
+     */
+    LocationId findLocation(const std::string& location) const;
+
+    /**
+     * @brief Set or move the coordinates of a location
+     * @param location Location string
+     * @param latitude Latitude in degrees
+     * @param longitude Longitude in degrees
+     * @return ID of the location
+     * @note Cached travel times involving the location are invalidated
+     */
+    LocationId setCoordinates(const std::string& location, double latitude, double longitude);
+
+    /**
+     * @brief Get the coordinates of a location
+     * @param id ID of the location
+     * @param latitude Receives the latitude in degrees
+     * @param longitude Receives the longitude in degrees
+     * @return True if the coordinates are known
+     */
+    bool getCoordinates(LocationId id, double& latitude, double& longitude) const;
+
+    /**
+     * @brief Check if the coordinates of a location are known
+     * @param location Location string
+     * @return True if the location can be used in travel queries
+     */
+    bool isResolved(const std::string& location) const;
+
+    /**
+     * @brief Load coordinates from a gazetteer file
+     * @param filename File with one "name;latitude;longitude" entry per line
+     * @return Number of locations loaded, or -1 if the file could not be opened
+     */
+    int loadGazetteer(const std::string& filename);
+
+    /**
+     * @brief Travel time between two locations
+     * @param from Origin
+     * @param to Destination
+     * @return Travel time in minutes, or -1 if a location is not resolved
+     */
+    double getTravelMinutes(LocationId from, LocationId to);
+
+    /**
+     * @brief Travel times from one location to many
+     * @param from Origin
+     * @param destinations Destinations
+     * @param useCache False to bypass the cache, for positions that move often
+     *                 (technicians) and would only evict the stable pairs
+     * @return Travel time in minutes per destination, -1 where not resolved
+     *
+     * Cache misses are computed together in one vectorizable pass.
+     */
+    std::vector<double> getTravelMinutesBatch(LocationId from, const std::vector<LocationId>& destinations,
+                                              bool useCache = true);
+
+    /**
+     * @brief Change the travel model
+     * @param roadFactor Ratio between road distance and great-circle distance
+     * @param averageSpeedKmh Average travel speed
+     * @note Clears the cache
+     */
+    void setTravelModel(double roadFactor, double averageSpeedKmh);
+
+    /**
+     * @brief Get the number of interned locations
+     * @return Number of locations
+     */
+    size_t getLocationCount() const;
+
+    /**
+     * @brief Get the cache statistics
+     * @param hits Receives the number of cache hits
+     * @param misses Receives the number of cache misses
+     * @return Number of cached pairs
+     */
+    size_t getCacheStats(size_t& hits, size_t& misses) const;
+};
+
+#endif // TRAVEL_TIME_SERVICE_H
@@ -58,6 +58,14 @@ public:
      */
     bool authenticate(const std::string& username, const std::string& password);
 
+    /**
+     * @brief Check credentials without logging the user in
+     * @param username Username
+     * @param password Plain text password
+     * @return True if they match a user (safe to call from several threads)
+     */
+    bool checkCredentials(const std::string& username, const std::string& password) const;
+
     /**
      * @brief Log out the current user
      */
@@ -20,6 +20,8 @@ class CLI {
 private:
     AuthenticationSystem authSystem;
     std::unique_ptr<InterventionManagerSecure> manager;
+    std::shared_ptr<const AccessPolicy> accessPolicy; // Tokens of the users are resolved from it at login
+    std::shared_ptr<NotificationStubServer> notificationStub; // Email/push endpoint while "notify stub on"
     bool running;
     std::string currentUser;
 
@@ -71,12 +73,27 @@ private:
     void handleDeleteIntervention(const std::vector<std::string>& args);
     void handleAssignTechnician(const std::vector<std::string>& args);
     void handleChangeStatus(const std::vector<std::string>& args);
+    void handleDispatch(const std::vector<std::string>& args);
+    void handleAutoAssign(const std::vector<std::string>& args);
+    void handleTravel(const std::vector<std::string>& args);
     void handleAddTechnician(const std::vector<std::string>& args);
     void handleListTechnicians(const std::vector<std::string>& args);
+    void handleFindSlot(const std::vector<std::string>& args);
+    void handleShift(const std::vector<std::string>& args);
     void handleCalendar(const std::vector<std::string>& args);
     void handleDecorateIntervention(const std::vector<std::string>& args);
     void handleAddAttachment(const std::vector<std::string>& args);
     void handleAddGPSCoordinate(const std::vector<std::string>& args);
+    void handleImportGPS(const std::vector<std::string>& args);
+    void handleTrackSummary(const std::vector<std::string>& args);
+    void handleTrackPoints(const std::vector<std::string>& args);
+    void handleSite(const std::vector<std::string>& args);
+    void handleNearby(const std::vector<std::string>& args);
+    void handleGeofence(const std::vector<std::string>& args);
+    void handleRecur(const std::vector<std::string>& args);
+    void handleAudit(const std::vector<std::string>& args);
+    void handlePolicy(const std::vector<std::string>& args);
+    void handleNotify(const std::vector<std::string>& args);
     void handleInitialize(const std::vector<std::string>& args);
     void handleExport(const std::vector<std::string>& args);
 
@@ -2,18 +2,20 @@
 // Created by Léo KRYS on 21/04/2025.
 //
 
-#ifndef ATTACHMENTS_DECORATOR_H
-#define ATTACHMENTS_DECORATOR_H
+#ifndef ATTACHMENTS_COMPONENT_H
+#define ATTACHMENTS_COMPONENT_H
 
-#include "Decorator/InterventionDecorator.h"
 #include <string>
 #include <vector>
+#include <ctime>
 
 /**
- * @class AttachmentsDecorator
- * @brief Adds file attachment functionality to an intervention
+ * @class AttachmentsComponent
+ * @brief File attachment capability of an intervention
+ *
+ * Stored in the manager's component table under the intervention ID.
  */
-class AttachmentsDecorator : public InterventionDecorator {
+class AttachmentsComponent {
 private:
     struct Attachment {
         std::string filename;
@@ -28,12 +30,6 @@ private:
     std::vector<Attachment> attachments;
 
 public:
-    /**
-     * @brief Constructor
-     * @param intervention The intervention to decorate
-     */
-    explicit AttachmentsDecorator(std::unique_ptr<Intervention> intervention);
-
     /**
      * @brief Add a file attachment
      * @param filename Name of the file
@@ -69,10 +65,10 @@ public:
     size_t getAttachmentCount() const;
 
     /**
-     * @brief Override getInfo to include attachment information
-     * @return Formatted string with intervention details including attachments
+     * @brief Describe the attachments for the intervention details
+     * @return Formatted attachment information
      */
-    std::string getInfo() const override;
+    std::string getInfo() const;
 };
 
-#endif // ATTACHMENTS_DECORATOR_H
\ No newline at end of file
+#endif // ATTACHMENTS_COMPONENT_H
\ No newline at end of file
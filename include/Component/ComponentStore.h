@@ -0,0 +1,167 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef COMPONENT_STORE_H
+#define COMPONENT_STORE_H
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <atomic>
+
+/**
+ * @class ComponentStore
+ * @brief Side tables of capabilities (GPS tracking, attachments...) keyed by intervention ID
+ *
+ * Each component type gets a dense family number the first time it is used,
+ * and its table sits at that index, so a typed lookup is one vector index
+ * plus one hash lookup, without RTTI. Adding a capability inserts into its
+ * table and leaves the intervention object untouched. Not thread-safe.
+ */
+class ComponentStore {
+private:
+    struct TableBase {
+        virtual ~TableBase() = default;
+        virtual bool remove(int interventionId) = 0;
+    };
+
+    template <typename T>
+    struct Table : TableBase {
+        std::unordered_map<int, T> components;
+
+        bool remove(int interventionId) override {
+            return components.erase(interventionId) > 0;
+        }
+    };
+
+    std::vector<std::unique_ptr<TableBase>> tables; // Indexed by family
+
+    static size_t nextFamily() {
+        static std::atomic<size_t> counter(0);
+        return counter++;
+    }
+
+    /**
+     * @brief Family number of a component type, the same for every store
+     */
+    template <typename T>
+    static size_t family() {
+        static const size_t id = nextFamily();
+        return id;
+    }
+
+    template <typename T>
+    Table<T>* findTable() const {
+        size_t id = family<T>();
+        return id < tables.size() ? static_cast<Table<T>*>(tables[id].get()) : nullptr;
+    }
+
+    template <typename T>
+    Table<T>& table() {
+        size_t id = family<T>();
+        if (id >= tables.size()) {
+            tables.resize(id + 1);
+        }
+        if (!tables[id]) {
+            tables[id] = std::make_unique<Table<T>>();
+        }
+        return *static_cast<Table<T>*>(tables[id].get());
+    }
+
+public:
+    /**
+     * @brief Give an intervention a component
+     * @tparam T Component type
+     * @param interventionId ID of the intervention
+     * @param args Constructor arguments of the component
+     * @return The new component, or the existing one if the intervention already has it
+     */
+    template <typename T, typename... Args>
+    T& add(int interventionId, Args&&... args) {
+        return table<T>().components.try_emplace(interventionId, std::forward<Args>(args)...).first->second;
+    }
+
+    /**
+     * @brief Get the component of an intervention
+     * @tparam T Component type
+     * @param interventionId ID of the intervention
+     * @return The component, or nullptr if the intervention does not have it
+     */
+    template <typename T>
+    T* get(int interventionId) {
+        Table<T>* components = findTable<T>();
+        if (!components) {
+            return nullptr;
+        }
+
+        auto it = components->components.find(interventionId);
+        return it != components->components.end() ? &it->second : nullptr;
+    }
+
+    /**
+     * @brief Get the component of an intervention
+     * @tparam T Component type
+     * @param interventionId ID of the intervention
+     * @return The component, or nullptr if the intervention does not have it
+     */
+    template <typename T>
+    const T* get(int interventionId) const {
+        return const_cast<ComponentStore*>(this)->get<T>(interventionId);
+    }
+
+    /**
+     * @brief Check whether an intervention has a component
+     * @tparam T Component type
+     * @param interventionId ID of the intervention
+     * @return True if it has the component
+     */
+    template <typename T>
+    bool has(int interventionId) const {
+        return get<T>(interventionId) != nullptr;
+    }
+
+    /**
+     * @brief Remove a component from an intervention
+     * @tparam T Component type
+     * @param interventionId ID of the intervention
+     * @return True if the intervention had the component
+     */
+    template <typename T>
+    bool remove(int interventionId) {
+        Table<T>* components = findTable<T>();
+        return components && components->remove(interventionId);
+    }
+
+    /**
+     * @brief Remove every component of an intervention
+     * @param interventionId ID of the intervention
+     */
+    void removeAll(int interventionId) {
+        for (auto& components : tables) {
+            if (components) {
+                components->remove(interventionId);
+            }
+        }
+    }
+
+    /**
+     * @brief Visit every component of a type
+     * @tparam T Component type
+     * @param visit Called with (intervention ID, component)
+     */
+    template <typename T, typename Visitor>
+    void forEach(Visitor visit) const {
+        const Table<T>* components = findTable<T>();
+        if (!components) {
+            return;
+        }
+
+        for (const auto& pair : components->components) {
+            visit(pair.first, pair.second);
+        }
+    }
+};
+
+#endif // COMPONENT_STORE_H
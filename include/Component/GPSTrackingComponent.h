@@ -0,0 +1,109 @@
+//
+// Created by Léo KRYS on 21/04/2025.
+//
+
+#ifndef GPS_TRACKING_COMPONENT_H
+#define GPS_TRACKING_COMPONENT_H
+
+#include "Business/CompressedTrack.h"
+#include "Business/TrackSimplifier.h"
+#include <string>
+#include <vector>
+#include <utility> // for std::pair
+#include <ctime>
+
+/**
+ * @class GPSTrackingComponent
+ * @brief GPS tracking capability of an intervention
+ *
+ * Stored in the manager's component table under the intervention ID.
+ */
+class GPSTrackingComponent {
+public:
+    using GPSCoordinate = TrackPoint;
+
+private:
+    CompressedTrack trackingData; // Coordinates are stored with 1e-7 degree precision
+    TrackSimplifier levelsOfDetail;
+    int updateFrequency; // in minutes
+
+public:
+    /**
+     * @brief Constructor
+     * @param updateFrequency How often to update coordinates (in minutes)
+     */
+    explicit GPSTrackingComponent(int updateFrequency = 15);
+
+    /**
+     * @brief Add a GPS coordinate to the tracking data
+     * @param latitude Latitude coordinate
+     * @param longitude Longitude coordinate
+     * @param timestamp Time the coordinate was recorded (defaults to current time)
+     */
+    void addCoordinate(double latitude, double longitude, std::time_t timestamp = std::time(nullptr));
+
+    /**
+     * @brief Get the most recent GPS coordinate
+     * @return Pair of latitude and longitude, or {0,0} if no data
+     */
+    std::pair<double, double> getCurrentLocation() const;
+
+    /**
+     * @brief Set the update frequency
+     * @param minutes Minutes between updates
+     */
+    void setUpdateFrequency(int minutes);
+
+    /**
+     * @brief Get the update frequency
+     * @return Minutes between updates
+     */
+    int getUpdateFrequency() const;
+
+    /**
+     * @brief Get all tracking data
+     * @return Vector of GPS coordinates (decoded from the compressed track)
+     */
+    std::vector<GPSCoordinate> getTrackingData() const;
+
+    /**
+     * @brief Get the tracking data of a time range
+     * @param from Start of the range (inclusive)
+     * @param to End of the range (inclusive)
+     * @return Vector of GPS coordinates, only decoding the blocks in the range
+     */
+    std::vector<GPSCoordinate> getTrackingData(std::time_t from, std::time_t to) const;
+
+    /**
+     * @brief Get a reduced version of the tracking data for display or export
+     * @param budget Maximum number of points
+     * @return The full track if it fits, otherwise the best level of detail sampled to the budget
+     */
+    std::vector<GPSCoordinate> getSimplifiedTrackingData(size_t budget) const;
+
+    /**
+     * @brief Set the distance tolerance of the simplified level and rebuild it
+     * @param meters Tolerance in meters
+     */
+    void setSimplificationTolerance(double meters);
+
+    /**
+     * @brief Get the number of tracking points
+     * @return Number of points
+     */
+    size_t getTrackingPointCount() const;
+
+    /**
+     * @brief Get the memory used by the tracking data
+     * @return Size in bytes, levels of detail included
+     */
+    size_t getTrackingMemoryUsage() const;
+
+    /**
+     * @brief Describe the tracking for the intervention details
+     * @return Formatted GPS information
+     */
+    std::string getInfo() const;
+};
+
+#endif // GPS_TRACKING_COMPONENT_H
\ No newline at end of file
@@ -29,6 +29,12 @@ public:
   */
  std::string getType() const override;
 
+ /**
+  * @brief Copy the wrapped intervention, without the decoration
+  * @return A new intervention of the underlying type
+  */
+ std::unique_ptr<Intervention> clone() const override;
+
  /**
   * @brief Get information about the intervention
   * @return Formatted string with intervention details
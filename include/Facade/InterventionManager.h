@@ -10,12 +10,28 @@
 #include "Business/TechnicianManager.h"
 #include "Business/NotificationSystem.h"
 #include "Factory/InterventionFactoryRegistry.h"
+#include "Business/TimerWheel.h"
+#include "Business/DispatchQueue.h"
+#include "Business/TravelTimeService.h"
+#include "Business/TrackAnalytics.h"
+#include "Business/SpatialIndex.h"
+#include "Business/GeofenceEngine.h"
+#include "Business/RecurrenceEngine.h"
+#include "Business/RecurrenceCache.h"
+#include "Component/ComponentStore.h"
+#include "Component/GPSTrackingComponent.h"
+#include "Component/AttachmentsComponent.h"
 #include "Observer/InterventionObserver.h"
 #include <map>
 #include <vector>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class EmergencyIntervention;
 
 /**
  * @class InterventionManager
@@ -23,22 +39,77 @@
  *
  * This class implements the IInterventionManager interface and serves
  * as a facade for the underlying subsystems.
+ *
+ * Time-driven work (reminders before an intervention, escalation of
+ * emergencies still scheduled past their start, periodic snapshots) is kept
+ * in a hierarchical timer wheel fired from a dedicated scheduler thread.
+ * Public operations are serialized by an internal mutex.
  */
 class InterventionManager : public IInterventionManager {
+public:
 private:
+    const InterventionFactoryRegistry& factoryRegistry; // Looked up once, at construction
     InterventionPlanner planner;
     TechnicianManager technicianManager;
     std::shared_ptr<NotificationSystem> notificationSystem;
     std::map<int, std::unique_ptr<Intervention>> interventions;
+    ComponentStore components; // Capabilities (GPS tracking, attachments) by intervention ID
     std::vector<std::shared_ptr<InterventionObserver>> observers;
+    std::shared_ptr<InterventionObserver> generalDigest; // Set by setGeneralDigest()
     int nextInterventionId;
 
+    // Emergencies nobody can take that one dispatch decision skips at most
+    static constexpr size_t MAX_DISPATCH_SKIPS = 16;
+
+    // Time-driven work
+    struct InterventionTimers {
+        TimerWheel::TimerId reminder = TimerWheel::INVALID_TIMER;
+        TimerWheel::TimerId escalation = TimerWheel::INVALID_TIMER;
+    };
+    TimerWheel scheduler;
+    std::map<int, InterventionTimers> interventionTimers;
+    int reminderLeadMinutes;
+    int escalationGraceMinutes;
+    TimerWheel::TimerId snapshotTimer;
+    int snapshotIntervalMinutes;
+    std::string snapshotFormat;
+    std::string snapshotFile;
+
+    // Emergency dispatch
+    DispatchQueue dispatchQueue;
+    std::map<int, std::pair<double, double>> siteCoordinates;             // Intervention ID -> (lat, lon)
+    std::map<std::string, std::pair<double, double>> technicianPositions; // Technician ID -> last (lat, lon)
+    std::map<std::string, TravelTimeService::LocationId> technicianLocations; // Same positions, in travelTimes
+    SpatialIndex<int> siteIndex;                                          // Same sites, by cell
+    SpatialIndex<std::string> technicianIndex;                            // Same positions, by cell
+    GeofenceEngine geofences;                                             // One fence per located site
+    double defaultGeofenceRadiusKm;
+    bool geofenceStartOnArrival;      // Arrival sets "In Progress"
+    bool geofenceCompleteOnDeparture; // Departure sets "Completed"
+    mutable TravelTimeService travelTimes; // Thread-safe cache, filled by const lookups too
+
+    // Recurring interventions, materialized a few days ahead
+    RecurrenceEngine recurrences;
+    std::map<int, std::pair<int, int>> recurringOccurrences; // Intervention ID -> (series ID, occurrence index)
+    int recurrenceHorizonDays;
+    TimerWheel::TimerId recurrenceTimer;
+    mutable RecurrenceCache recurrenceCache; // Occurrences past the horizon, by calendar window
+
+    mutable std::recursive_mutex managerMutex; // Serializes public operations and timer callbacks
+    std::thread schedulerThread;
+    std::mutex schedulerWakeMutex;
+    std::condition_variable schedulerWake;
+    bool schedulerStopping;
+
     /**
      * @brief Notify all observers about an event
      * @param eventType Type of event (e.g., "creation", "modification")
      * @param message Message describing the event
+     * @param interventionId ID of the intervention concerned (-1 if none)
+     * @param technicianId ID of the technician concerned (empty if none)
      */
-    void notifyObservers(const std::string& eventType, const std::string& message);
+    void notifyObservers(const std::string& eventType, const std::string& message,
+                         int interventionId = -1, const std::string& technicianId = "");
 
     /**
      * @brief Check if an intervention exists by ID
@@ -61,12 +132,184 @@ private:
      */
     std::string formatDate(std::time_t date) const;
 
+    /**
+     * @brief Register a technician in its default notification groups
+     * @param technician The technician to register
+     */
+    void registerTechnicianGroups(const Technician& technician);
+
+    /**
+     * @brief Store a freshly created intervention (ID, planning, dispatch, timers)
+     * @param intervention The intervention to store
+     * @param type Type of the intervention
+     * @return ID of the intervention, or -1 if it could not be scheduled
+     */
+    int storeNewIntervention(std::unique_ptr<Intervention> intervention, const std::string& type);
+
+    /**
+     * @brief Record the last position of a technician
+     * @param technicianId ID of the technician
+     * @param latitude Latitude in degrees
+     * @param longitude Longitude in degrees
+     */
+    void recordTechnicianPosition(const std::string& technicianId, double latitude, double longitude);
+
+    /**
+     * @brief Travel times from an intervention site to technicians' last positions, in one batch
+     * @param interventionId ID of the intervention
+     * @param technicianIds IDs of the technicians
+     * @return Minutes per technician, -1 where either position is unknown
+     */
+    std::vector<double> travelMinutesToSite(int interventionId, const std::vector<std::string>& technicianIds) const;
+
+    /**
+     * @brief Find the technician to dispatch to an emergency
+     * @param job The queued emergency
+     * @param allowPreemption Whether scheduled maintenance may be bumped when nobody is free
+     * @param proposal Receives the technician, distance and bumped interventions
+     * @return True if a technician can take the job
+     */
+    bool proposeTechnician(const DispatchQueue::Job& job, bool allowPreemption, DispatchProposal& proposal) const;
+
+    /**
+     * @brief Get the coordinates of an intervention site
+     * @param interventionId ID of the intervention
+     * @param coordinates Receives (latitude, longitude)
+     * @return True if the site was set explicitly or its location is resolved
+     */
+    bool resolveSiteCoordinates(int interventionId, std::pair<double, double>& coordinates) const;
+
+    /**
+     * @brief Run a technician position through the geofences and apply the crossings
+     * @param technicianId ID of the technician
+     * @param latitude Latitude
+     * @param longitude Longitude
+     */
+    void applyGeofences(const std::string& technicianId, double latitude, double longitude);
+
+    /**
+     * @brief Get the emergency behind an intervention, looking through decorators
+     * @param intervention The intervention
+     * @return The emergency, or nullptr if the intervention is not one
+     */
+    static const EmergencyIntervention* asEmergency(const Intervention* intervention);
+
+    /**
+     * @brief Find the assignments to bump so a technician can take an emergency
+     * @param technicianId ID of the technician
+     * @param date Start of the emergency
+     * @param duration Duration of the emergency in minutes
+     * @param bumped Receives the IDs of the maintenance interventions in the way
+     * @return True if the technician can be freed by bumping scheduled maintenance only
+     */
+    bool findPreemptableInterventions(const std::string& technicianId, std::time_t date,
+                                      int duration, std::vector<int>& bumped) const;
+
+    /**
+     * @brief (Re)arm the reminder and escalation timers of an intervention
+     * @param interventionId ID of the intervention
+     */
+    void armInterventionTimers(int interventionId);
+
+    /**
+     * @brief Cancel the timers of an intervention
+     * @param interventionId ID of the intervention
+     */
+    void cancelInterventionTimers(int interventionId);
+
+    /**
+     * @brief Send the reminder of an upcoming intervention
+     * @param interventionId ID of the intervention
+     */
+    void fireReminder(int interventionId);
+
+    /**
+     * @brief Escalate an emergency that has not started on time
+     * @param interventionId ID of the intervention
+     */
+    void fireEscalation(int interventionId);
+
+    /**
+     * @brief Export a snapshot of the schedule and re-arm the snapshot timer
+     */
+    void fireSnapshot();
+
+    /**
+     * @brief Materialize the occurrences due within the horizon and arm the daily timer
+     */
+    void extendRecurrenceHorizon();
+
+    /**
+     * @brief Daily timer moving the recurrence horizon forward
+     */
+    void fireRecurrenceHorizon();
+
+    /**
+     * @brief Scheduler thread loop, advances the timer wheel every second
+     */
+    void runScheduler();
+
 public:
     /**
      * @brief Constructor
      */
     InterventionManager();
 
+    /**
+     * @brief Destructor - stops the scheduler thread
+     */
+    ~InterventionManager() override;
+
+    InterventionManager(const InterventionManager&) = delete;
+    InterventionManager& operator=(const InterventionManager&) = delete;
+
+    /**
+     * @brief Set how long before an intervention its technician is reminded
+     * @param minutes Minutes before the start (0 to disable reminders)
+     */
+    void setReminderLead(int minutes);
+
+    /**
+     * @brief Set how long an emergency may stay "Scheduled" past its start
+     * @param minutes Minutes after the start before escalating
+     */
+    void setEscalationGrace(int minutes);
+
+    /**
+     * @brief Export the schedule periodically
+     * @param intervalMinutes Minutes between two snapshots
+     * @param format Export format ("text", "csv", "json")
+     * @param outputFile Path of the snapshot file
+     * @return True if snapshots were enabled
+     */
+    bool enablePeriodicSnapshots(int intervalMinutes, const std::string& format, const std::string& outputFile);
+
+    /**
+     * @brief Stop the periodic snapshots
+     */
+    void disablePeriodicSnapshots();
+
+    /**
+     * @brief Fire every timer due up to a given time
+     * @param now Current time
+     * @return Number of timers fired
+     * @note The scheduler thread calls this every second
+     */
+    size_t processTimers(std::time_t now);
+
+    /**
+     * @brief Get the number of pending timers
+     * @return Number of pending timers
+     */
+    size_t getPendingTimerCount() const;
+
+    /**
+     * @brief Hold the manager's lock across several calls
+     * @return The held lock; the manager's own calls can still be made by the holder
+     * @note Interventions read through pointers stay valid and unchanged while it is held
+     */
+    std::unique_lock<std::recursive_mutex> lockState() const;
+
     /**
      * @brief Add an observer
      * @param observer Shared pointer to the observer
@@ -79,6 +322,14 @@ public:
      */
     void removeObserver(InterventionObserver* observer);
 
+    /**
+     * @brief Broadcast the events without a technician as a periodic digest
+     * @param enabled True to register the digest observer, false to remove it
+     * @param intervalSeconds Seconds between two digests
+     * @note Off by default. Technicians are notified directly either way.
+     */
+    void setGeneralDigest(bool enabled, int intervalSeconds = 60);
+
     /**
      * @brief Add a technician to the system
      * @param technician The technician to add
@@ -86,6 +337,25 @@ public:
      */
     bool addTechnician(const Technician& technician);
 
+    /**
+     * @brief Add a technician to a named notification group
+     * @param technicianId ID of the technician
+     * @param group Name of the group (e.g., "zone:3", "oncall:week42")
+     * @return True if the technician exists and was added
+     *
+     * Every technician is automatically a member of "technicians" and
+     * "specialty:<specialty>".
+     */
+    bool addTechnicianToGroup(const std::string& technicianId, const std::string& group);
+
+    /**
+     * @brief Notify every member of a notification group
+     * @param group Name of the group
+     * @param message Notification message
+     * @return Number of members notified
+     */
+    int notifyGroup(const std::string& group, const std::string& message);
+
     /**
      * @brief Get all technicians
      * @return Map of technician IDs to technicians
@@ -102,18 +372,287 @@ public:
     std::vector<std::string> findAvailableTechnicians(std::time_t date, int duration,
                                                     const std::string& specialty = "") const;
 
+    /**
+     * @brief Find the earliest free slots across technicians
+     * @param duration Duration of the slot in minutes
+     * @param specialty Optional specialty requirement
+     * @param notBefore Earliest allowed start
+     * @param horizon Latest allowed end
+     * @param count Maximum number of options to return
+     * @return Up to count (start, technician) options, earliest first
+     */
+    std::vector<TechnicianManager::SlotOption> findEarliestSlots(int duration, const std::string& specialty,
+                                                                 std::time_t notBefore, std::time_t horizon,
+                                                                 size_t count = 1) const override;
+
+    /**
+     * @brief Get the shift calendar of a technician, creating it if needed
+     * @param technicianId ID of the technician
+     * @return Pointer to the calendar or nullptr if the technician does not exist
+     * @note Once a calendar exists the technician only works during its shifts
+     */
+    ShiftCalendar* getShiftCalendar(const std::string& technicianId);
+
+    /**
+     * @brief Add an entry to the shift calendar of a technician
+     * @param technicianId ID of the technician
+     * @param kind Kind of entry
+     * @param start Start of the entry
+     * @param end End of the entry
+     * @return True if the technician exists and the period is not empty
+     */
+    bool addShiftEntry(const std::string& technicianId, ShiftCalendar::EntryKind kind,
+                       std::time_t start, std::time_t end) override;
+
+    /**
+     * @brief Count the working minutes of a technician in a period
+     * @param technicianId ID of the technician
+     * @param from Start of the period
+     * @param to End of the period
+     * @return Number of minutes (the whole period without a calendar), or -1 if the technician does not exist
+     */
+    int getAvailableMinutes(const std::string& technicianId, std::time_t from, std::time_t to) const override;
+
+    /**
+     * @brief Set the coordinates of an intervention site
+     * @param interventionId ID of the intervention
+     * @param latitude Latitude of the site
+     * @param longitude Longitude of the site
+     * @return True if the intervention exists
+     */
+    bool setSiteCoordinates(int interventionId, double latitude, double longitude) override;
+
+    /**
+     * @brief Load location coordinates from a gazetteer file
+     * @param filename File with one "name;latitude;longitude" entry per line
+     * @return Number of locations loaded, or -1 if the file could not be opened
+     */
+    int loadGazetteer(const std::string& filename) override;
+
+    /**
+     * @brief Resolve unknown locations from the GPS history of their interventions
+     * @return Number of locations resolved
+     */
+    int resolveLocationsFromTracking() override;
+
+    /**
+     * @brief Travel time between the locations of two interventions
+     * @param fromInterventionId ID of the origin intervention
+     * @param toInterventionId ID of the destination intervention
+     * @return Travel time in minutes, or -1 if a location is not resolved
+     */
+    double getTravelMinutes(int fromInterventionId, int toInterventionId) override;
+
+    /**
+     * @brief Get the shared travel-time service
+     * @return Reference to the service (thread-safe)
+     */
+    TravelTimeService& getTravelTimeService();
+
+    /**
+     * @brief Get the notification system
+     * @return The notification system (thread-safe)
+     */
+    std::shared_ptr<NotificationSystem> getNotificationSystem() const;
+
+    /**
+     * @brief Record the current position of a technician
+     * @param technicianId ID of the technician
+     * @param latitude Latitude
+     * @param longitude Longitude
+     * @note GPS coordinates added to an assigned intervention update it automatically
+     */
+    void updateTechnicianPosition(const std::string& technicianId, double latitude, double longitude);
+
+    /**
+     * @brief Set the radius of the geofence around an intervention site
+     * @param interventionId ID of the intervention
+     * @param radiusKm Radius in kilometers (at most GeofenceEngine::MAX_RADIUS_KM)
+     * @return True if the site has coordinates and the radius is valid
+     */
+    bool setGeofenceRadius(int interventionId, double radiusKm) override;
+
+    /**
+     * @brief Choose which status changes geofence crossings apply
+     * @param startOnArrival Set "In Progress" when the assigned technician arrives at a scheduled intervention
+     * @param completeOnDeparture Set "Completed" when the assigned technician leaves an intervention in progress
+     * @return True
+     * @note Arrival and departure events are notified either way
+     */
+    bool setGeofenceAutoStatus(bool startOnArrival, bool completeOnDeparture) override;
+
+    /**
+     * @brief Create a recurring intervention
+     * @param type The intervention type
+     * @param location The location of every occurrence
+     * @param start Date and time of the first occurrence
+     * @param duration The duration in minutes
+     * @param rule The repetition pattern
+     * @return ID of the series, or -1 if creation failed
+     * @note Occurrences become interventions only once they are within the recurrence horizon
+     */
+    int createRecurringIntervention(const std::string& type, const std::string& location,
+                                    std::time_t start, int duration, const RecurrenceRule& rule) override;
+
+    /**
+     * @brief Stop a recurring series
+     * @param seriesId ID of the series
+     * @return True if the series existed
+     * @note Occurrences already materialized stay as ordinary interventions
+     */
+    bool deleteRecurringSeries(int seriesId) override;
+
+    /**
+     * @brief Cancel one occurrence of a series (deleting it if already materialized)
+     * @param seriesId ID of the series
+     * @param index Index of the occurrence (0 for the first)
+     * @return True if the occurrence was cancelled
+     */
+    bool cancelOccurrence(int seriesId, int index) override;
+
+    /**
+     * @brief Move one occurrence of a series (rescheduling it if already materialized)
+     * @param seriesId ID of the series
+     * @param index Index of the occurrence (0 for the first)
+     * @param date New date and time
+     * @return True if the occurrence was moved
+     */
+    bool moveOccurrence(int seriesId, int index, std::time_t date) override;
+
+    /**
+     * @brief Turn the pending occurrences of a window into interventions
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @return Number of interventions created
+     * @note Occurrences falling on a full day stay pending, without using an ID, and
+     *       count as missed once their date has passed
+     */
+    size_t materializeRecurrences(std::time_t from, std::time_t to);
+
+    /**
+     * @brief Set how far ahead occurrences are materialized
+     * @param days Number of days (at least 1)
+     * @return True
+     */
+    bool setRecurrenceHorizon(int days) override;
+
+    /**
+     * @brief Get the recurring series
+     * @return Reference to the recurrence engine
+     * @note Not thread-safe: use from the thread calling the manager
+     */
+    const RecurrenceEngine& getRecurrences() const;
+
+    /**
+     * @brief Describe a recurring series
+     * @param seriesId ID of the series
+     * @return Type, location, rule and missed occurrences, or an empty string if not found
+     */
+    std::string getRecurringSeriesInfo(int seriesId) const override;
+
+    /**
+     * @brief Get the pending occurrences of a series in a window
+     * @param seriesId ID of the series
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @return The occurrences not materialized yet, in date order
+     */
+    std::vector<RecurrenceEngine::Occurrence> getPendingOccurrences(int seriesId, std::time_t from,
+                                                                    std::time_t to) const override;
+
+    /**
+     * @brief Find the interventions whose site lies within a radius
+     * @param latitude Latitude of the center
+     * @param longitude Longitude of the center
+     * @param radiusKm Radius in kilometers
+     * @return (intervention ID, distance in km) pairs, nearest first
+     * @note Only sites given coordinates with setSiteCoordinates are indexed
+     */
+    std::vector<std::pair<int, double>> findInterventionsWithin(double latitude, double longitude, double radiusKm) const override;
+
+    /**
+     * @brief Find the technicians whose last known position is nearest to a point
+     * @param latitude Latitude of the point
+     * @param longitude Longitude of the point
+     * @param count Maximum number of technicians
+     * @return (technician ID, distance in km) pairs, nearest first
+     */
+    std::vector<std::pair<std::string, double>> findNearestTechnicians(double latitude, double longitude, size_t count) const override;
+
+    /**
+     * @brief Propose a technician for the most urgent unassigned emergency
+     * @param allowPreemption Whether scheduled maintenance may be bumped when nobody is free
+     * @return The proposal (technicianId is empty if nobody can take the job)
+     *
+     * Emergencies are ordered by priority, then age; one nobody can take is
+     * skipped for the next, up to MAX_DISPATCH_SKIPS of them. Free technicians
+     * with the required specialty are preferred, nearest first.
+     */
+    DispatchProposal proposeDispatch(bool allowPreemption = true) const override;
+
+    /**
+     * @brief Assign the proposed technician to the most urgent emergency
+     * @param allowPreemption Whether scheduled maintenance may be bumped when nobody is free
+     * @return True if the emergency was dispatched
+     */
+    bool dispatchNextEmergency(bool allowPreemption = true) override;
+
+    /**
+     * @brief Assign technicians to every unassigned scheduled intervention
+     * @param greedy Use the greedy baseline instead of the optimal matching
+     * @param maxRounds Maximum number of matching rounds
+     * @return Summary of the assignments made
+     *
+     * Each round matches unassigned interventions with available technicians
+     * of the required specialty, minimizing the total travel time. A round
+     * is applied all or nothing.
+     */
+    AutoAssignReport autoAssignTechnicians(bool greedy = false, int maxRounds = 8) override;
+
+    /**
+     * @brief Get the number of emergencies waiting for a technician
+     * @return Number of queued emergencies
+     */
+    size_t getDispatchQueueSize() const override;
+
     /**
      * @brief Get a summary of all interventions
      * @return Formatted summary string
      */
     std::string generateSystemSummary() const;
 
+    /**
+     * @brief Get the ID of an intervention type, to create many interventions of it
+     * @param type The intervention type
+     * @return ID of the type, or InterventionFactoryRegistry::INVALID_TYPE if not registered
+     */
+    InterventionFactoryRegistry::TypeId resolveInterventionType(const std::string& type) const;
+
+    /**
+     * @brief Create an intervention of a type resolved with resolveInterventionType()
+     * @param typeId ID of the type
+     * @param location The location of the intervention
+     * @param date The date and time of the intervention
+     * @param duration The duration in minutes
+     * @return The ID of the created intervention, or -1 if creation failed
+     */
+    int createIntervention(InterventionFactoryRegistry::TypeId typeId,
+                          const std::string& location,
+                          std::time_t date,
+                          int duration);
+
     // IInterventionManager interface implementation
     int createIntervention(const std::string& type,
                           const std::string& location,
                           std::time_t date,
                           int duration) override;
 
+    int createEmergencyIntervention(const std::string& location,
+                                    std::time_t date,
+                                    int duration,
+                                    int priority,
+                                    const std::string& specialty = "") override;
+
     bool deleteIntervention(int interventionId) override;
 
     bool modifyIntervention(int interventionId,
@@ -130,6 +669,8 @@ public:
 
     const Intervention* getIntervention(int interventionId) const override;
 
+    std::string getInterventionInfo(int interventionId) const override;
+
     std::vector<const Intervention*> getInterventionsForDay(std::time_t date) const override;
 
     std::map<int, int> getInterventionCountsForMonth(int month, int year) const override;
@@ -156,21 +697,21 @@ public:
     bool initializeWithSampleData();
 
     /**
-     * @brief Decorate an intervention with GPS tracking capability
+     * @brief Give an intervention the GPS tracking capability
      * @param interventionId ID of the intervention
-     * @return True if decoration was successful
+     * @return True if the intervention exists (it may already have the capability)
      */
     bool decorateWithGPS(int interventionId) override;
 
     /**
-     * @brief Decorate an intervention with attachments capability
+     * @brief Give an intervention the attachments capability
      * @param interventionId ID of the intervention
-     * @return True if decoration was successful
+     * @return True if the intervention exists (it may already have the capability)
      */
     bool decorateWithAttachments(int interventionId) override;
 
     /**
-     * @brief Add a GPS coordinate to a GPS-decorated intervention
+     * @brief Add a GPS coordinate to a GPS-tracked intervention
      * @param interventionId ID of the intervention
      * @param latitude Latitude coordinate
      * @param longitude Longitude coordinate
@@ -179,7 +720,37 @@ public:
     bool addGPSCoordinate(int interventionId, double latitude, double longitude) override;
 
     /**
-     * @brief Add an attachment to an attachment-decorated intervention
+     * @brief Add a batch of GPS fixes from any number of devices
+     * @param samples The fixes, in any order
+     * @return Number of fixes stored
+     *
+     * Fixes are grouped by intervention and sorted by time, so each
+     * intervention is looked up once and its track is appended in one pass.
+     * Geofences see every fix; the technician's position is updated once per
+     * group. A single "gps_batch" event is notified for the whole batch.
+     */
+    size_t addGPSCoordinates(const std::vector<GPSSample>& samples) override;
+
+    /**
+     * @brief Compute the analytics of a GPS-tracked intervention's track
+     * @param interventionId ID of the intervention
+     * @param summary Receives the analytics
+     * @param siteRadiusKm Radius around the site counted as "on site"
+     * @return True if the intervention exists and has GPS tracking
+     */
+    bool getTrackSummary(int interventionId, TrackAnalytics::Summary& summary, double siteRadiusKm = 0.1) override;
+
+    /**
+     * @brief Get the GPS track of an intervention within a point budget
+     * @param interventionId ID of the intervention
+     * @param budget Maximum number of points
+     * @param points Receives the points
+     * @return True if the intervention exists and has GPS tracking
+     */
+    bool getTrackPoints(int interventionId, size_t budget, std::vector<GPSTrackingComponent::GPSCoordinate>& points) override;
+
+    /**
+     * @brief Add an attachment to an intervention with the attachments capability
      * @param interventionId ID of the intervention
      * @param filename Name of the file
      * @param description Optional description of the file
@@ -13,6 +13,9 @@
 /**
  * @class InterventionFactory
  * @brief Abstract factory interface for creating interventions
+ *
+ * The objects come from the per-type slab pools of Intervention::operator new,
+ * so factories keep returning plain std::unique_ptr.
  */
 class InterventionFactory {
 public:
@@ -6,20 +6,49 @@
 #define INTERVENTION_FACTORY_REGISTRY_H
 
 #include <map>
+#include <vector>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <cstdint>
 #include "Factory/InterventionFactory.h"
 
 /**
  * @class InterventionFactoryRegistry
  * @brief Singleton registry for intervention factories
+ *
+ * Each registered type gets a dense integer ID. Resolve the ID once with
+ * resolveType() and create with it: that is a direct indexed call. Once
+ * startup registration is over, freeze() replaces the name lookup by a
+ * perfect hash and makes the registry read-only, so it can be used from any
+ * thread without locking.
  */
 class InterventionFactoryRegistry {
+public:
+    using TypeId = int;
+    static constexpr TypeId INVALID_TYPE = -1;
+
 private:
-    std::map<std::string, std::unique_ptr<InterventionFactory>> factories;
+    std::vector<std::unique_ptr<InterventionFactory>> factories; // Indexed by type ID
+    std::vector<std::string> typeNames;                          // Indexed by type ID
+    std::map<std::string, TypeId> typeIds;                       // Lookup until frozen
+
+    // Perfect hash built by freeze()
+    bool frozen;
+    std::uint64_t hashSeed;
+    std::uint64_t hashMask;
+    std::vector<TypeId> hashSlots;
 
     // Private constructor for singleton
-    InterventionFactoryRegistry() = default;
+    InterventionFactoryRegistry();
+
+    /**
+     * @brief Hash a type name
+     * @param name The name
+     * @param seed Seed selected by freeze()
+     * @return The hash
+     */
+    static std::uint64_t hashName(std::string_view name, std::uint64_t seed);
 
 public:
     // Delete copy constructor and assignment operator
@@ -36,8 +65,40 @@ public:
      * @brief Register a factory for a type
      * @param type The intervention type
      * @param factory Unique pointer to the factory
+     * @return ID of the type (kept if the type is registered again), or INVALID_TYPE once frozen
+     */
+    TypeId registerFactory(const std::string& type, std::unique_ptr<InterventionFactory> factory);
+
+    /**
+     * @brief Build the perfect hash of the type names and stop accepting registrations
+     */
+    void freeze();
+
+    /**
+     * @brief Check whether the registry is frozen
+     * @return True after freeze()
+     */
+    bool isFrozen() const;
+
+    /**
+     * @brief Get the ID of a type
+     * @param type The intervention type
+     * @return ID of the type, or INVALID_TYPE if not registered
+     */
+    TypeId resolveType(std::string_view type) const;
+
+    /**
+     * @brief Get the name of a type
+     * @param typeId ID of the type
+     * @return Name of the type, or an empty string if the ID is invalid
+     */
+    const std::string& getTypeName(TypeId typeId) const;
+
+    /**
+     * @brief Get the number of registered types
+     * @return Number of types (IDs are 0 to count - 1)
      */
-    void registerFactory(const std::string& type, std::unique_ptr<InterventionFactory> factory);
+    size_t getTypeCount() const;
 
     /**
      * @brief Get a factory for a type
@@ -46,6 +107,15 @@ public:
      */
     const InterventionFactory* getFactory(const std::string& type) const;
 
+    /**
+     * @brief Get a factory by type ID
+     * @param typeId ID of the type
+     * @return Pointer to the factory, or nullptr if the ID is invalid
+     */
+    const InterventionFactory* getFactory(TypeId typeId) const {
+        return typeId >= 0 && static_cast<size_t>(typeId) < factories.size() ? factories[typeId].get() : nullptr;
+    }
+
     /**
      * @brief Create an intervention of a specific type
      * @param type The intervention type
@@ -59,6 +129,23 @@ public:
         const std::string& location,
         std::time_t date,
         int duration) const;
+
+    /**
+     * @brief Create an intervention of a type resolved beforehand
+     * @param typeId ID of the type
+     * @param location The location of the intervention
+     * @param date The date and time of the intervention
+     * @param duration The duration in minutes
+     * @return Unique pointer to a new intervention, or nullptr if the ID is invalid
+     */
+    std::unique_ptr<Intervention> createIntervention(
+        TypeId typeId,
+        const std::string& location,
+        std::time_t date,
+        int duration) const {
+        const InterventionFactory* factory = getFactory(typeId);
+        return factory ? factory->createIntervention(location, date, duration) : nullptr;
+    }
 };
 
-#endif // INTERVENTION_FACTORY_REGISTRY_H
\ No newline at end of file
+#endif // INTERVENTION_FACTORY_REGISTRY_H
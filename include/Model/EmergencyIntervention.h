@@ -14,6 +14,7 @@
 class EmergencyIntervention : public Intervention {
 private:
     int priority; // 1-5, 5 being the highest
+    std::string requiredSpecialty; // Empty if any technician can handle it
 
 public:
     /**
@@ -36,6 +37,12 @@ public:
      */
     std::string getType() const override;
 
+    /**
+     * @brief Copy the intervention
+     * @return A new emergency intervention with the same fields, priority and specialty
+     */
+    std::unique_ptr<Intervention> clone() const override;
+
     /**
      * @brief Get the priority level
      * @return Priority level (1-5)
@@ -48,6 +55,18 @@ public:
      */
     void setPriority(int priority);
 
+    /**
+     * @brief Get the specialty required to handle the emergency
+     * @return Required specialty, or empty string if any
+     */
+    std::string getRequiredSpecialty() const;
+
+    /**
+     * @brief Set the specialty required to handle the emergency
+     * @param specialty Required specialty (empty if any)
+     */
+    void setRequiredSpecialty(const std::string& specialty);
+
     /**
      * @brief Override getInfo method to include priority
      * @return Formatted information as a string
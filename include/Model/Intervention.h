@@ -5,14 +5,22 @@
 #ifndef INTERVENTION_H
 #define INTERVENTION_H
 
+#include "Model/SlabPool.h"
 #include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
 #include <ctime>
+#include <cstddef>
 
 /**
  * @class Intervention
  * @brief Abstract class representing a technical intervention
  */
 class Intervention {
+private:
+    const Intervention* fieldOwner; // Object storing the fields, nullptr for this one
+
 protected:
     int id;
     std::string location;
@@ -21,6 +29,17 @@ protected:
     std::string technicianId;
     std::string status;
     std::string comments;
+    std::string_view typeName; // Set by concrete types, must outlive the object
+
+    friend class InterventionDecorator;
+
+    /**
+     * @brief Get the object that stores the fields (the innermost one behind decorators)
+     * @return The intervention holding the fields
+     */
+    const Intervention& fields() const {
+        return fieldOwner ? *fieldOwner : *this;
+    }
 
 public:
     /**
@@ -41,6 +60,29 @@ public:
      */
     virtual ~Intervention() = default;
 
+    /**
+     * @brief Allocate an intervention from the slab pool of its size
+     * @param size Size of the concrete type (decorators included)
+     * @return Memory for the object
+     *
+     * Each concrete type gets its own pool, so objects of one type sit
+     * together and slots freed by deletions are reused.
+     */
+    static void* operator new(std::size_t size);
+
+    /**
+     * @brief Return an intervention's memory to its pool
+     * @param pointer The object's memory
+     * @param size Size of the concrete type
+     */
+    static void operator delete(void* pointer, std::size_t size) noexcept;
+
+    /**
+     * @brief Get the usage of the intervention pools
+     * @return One entry per pool in use
+     */
+    static std::vector<SlabPool::Stats> getAllocationStats();
+
     // Getters and setters - all made virtual
     virtual int getId() const;
     virtual void setId(int id);
@@ -69,12 +111,27 @@ public:
      */
     virtual std::string getType() const = 0;
 
+    /**
+     * @brief Copy the intervention (prototype of recurring interventions)
+     * @return A new intervention of the same type with the same fields
+     */
+    virtual std::unique_ptr<Intervention> clone() const = 0;
+
     /**
      * @brief Get detailed information about the intervention
      * @return Formatted information as a string
      */
     virtual std::string getInfo() const;
 
+    // Non-virtual, non-allocating accessors for listings and exports. They
+    // read the stored fields directly (through any decorator) and stay valid
+    // until the field is modified.
+    std::string_view getTypeView() const { return fields().typeName; }
+    std::string_view getLocationView() const { return fields().location; }
+    std::string_view getTechnicianIdView() const { return fields().technicianId; }
+    std::string_view getStatusView() const { return fields().status; }
+    std::string_view getCommentsView() const { return fields().comments; }
+
     virtual void clear();
 
 };
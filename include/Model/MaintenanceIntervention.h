@@ -30,6 +30,12 @@ public:
      * @return "Maintenance"
      */
     std::string getType() const override;
+
+    /**
+     * @brief Copy the intervention
+     * @return A new maintenance intervention with the same fields
+     */
+    std::unique_ptr<Intervention> clone() const override;
 };
 
 #endif // MAINTENANCE_INTERVENTION_H
\ No newline at end of file
@@ -0,0 +1,101 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef SLAB_POOL_H
+#define SLAB_POOL_H
+
+#include <vector>
+#include <mutex>
+#include <memory_resource>
+#include <cstddef>
+
+/**
+ * @class SlabPool
+ * @brief Fixed-size slot allocator carving objects out of large slabs
+ *
+ * Slabs come from an upstream std::pmr::memory_resource and grow
+ * geometrically, so objects allocated together sit next to each other.
+ * Freed slots go on an intrusive free list and are reused first. Slabs are
+ * only returned upstream when the pool is destroyed, so the upstream must
+ * outlive the pool. Thread-safe.
+ */
+class SlabPool {
+public:
+    /**
+     * @brief Usage figures of a pool
+     */
+    struct Stats {
+        size_t slotSize = 0;
+        size_t slotsInUse = 0;
+        size_t slotCapacity = 0;
+        size_t slabCount = 0;
+        size_t bytesReserved = 0;
+    };
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    struct Slab {
+        void* memory;
+        size_t bytes;
+    };
+
+    size_t slotSize;
+    size_t nextSlabSlots;
+    std::pmr::memory_resource* upstream;
+    std::vector<Slab> slabs;
+    FreeSlot* freeList;
+    char* cursor;       // Unused part of the newest slab
+    char* cursorEnd;
+    size_t slotsInUse;
+    size_t slotCapacity;
+    mutable std::mutex mutex;
+
+    static constexpr size_t FIRST_SLAB_SLOTS = 64;
+    static constexpr size_t MAX_SLAB_SLOTS = 4096;
+
+    /**
+     * @brief Get a new slab from upstream (caller holds the mutex)
+     */
+    void grow();
+
+public:
+    /**
+     * @brief Constructor
+     * @param slotSize Size of the objects (rounded up to the maximum alignment)
+     * @param upstream Resource providing the slabs
+     */
+    explicit SlabPool(size_t slotSize,
+                      std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    /**
+     * @brief Destructor, returns every slab upstream
+     */
+    ~SlabPool();
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    /**
+     * @brief Allocate one slot
+     * @return Pointer to uninitialized memory of the slot size
+     */
+    void* allocate();
+
+    /**
+     * @brief Give a slot back for reuse
+     * @param slot Pointer returned by allocate()
+     */
+    void deallocate(void* slot);
+
+    /**
+     * @brief Get the usage figures
+     * @return The figures
+     */
+    Stats getStats() const;
+};
+
+#endif // SLAB_POOL_H
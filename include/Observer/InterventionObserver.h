@@ -6,6 +6,26 @@
 #define INTERVENTION_OBSERVER_H
 
 #include <string>
+#include <ctime>
+
+/**
+ * @struct InterventionEvent
+ * @brief Structured description of an intervention event
+ *
+ * Carries the routing data (intervention and technician) alongside the
+ * human-readable message so observers don't have to parse the text.
+ */
+struct InterventionEvent {
+    std::string eventType;
+    std::string message;
+    int interventionId;
+    std::string technicianId; // Empty when no technician is concerned
+
+    InterventionEvent(const std::string& eventType, const std::string& message,
+                      int interventionId = -1, const std::string& technicianId = "")
+        : eventType(eventType), message(message),
+          interventionId(interventionId), technicianId(technicianId) {}
+};
 
 /**
  * @class InterventionObserver
@@ -24,6 +44,16 @@ public:
      */
     virtual void notify(const std::string& message) = 0;
 
+    /**
+     * @brief Notification method receiving the structured event
+     * @param event Event with its routing data
+     *
+     * The default implementation forwards the message to notify().
+     */
+    virtual void notifyEvent(const InterventionEvent& event) {
+        notify(event.message);
+    }
+
     /**
      * @brief Check if this observer is interested in a specific event
      * @param eventType Type of event (e.g., "creation", "modification", "deletion")
@@ -33,6 +63,19 @@ public:
        (void)eventType; // Explicitly mark as unused
        return true; // Default implementation is interested in all events
     }
+
+    /**
+     * @brief Called about every second by the manager's scheduler thread
+     * @param now Current time
+     *
+     * Lets observers that aggregate events deliver them during quiet periods.
+     * Runs without the manager's lock, concurrently with notifications, and
+     * may run once more just after the observer was removed. The default
+     * implementation does nothing.
+     */
+    virtual void onTick(std::time_t now) {
+        (void)now; // Explicitly mark as unused
+    }
 };
 
 #endif // INTERVENTION_OBSERVER_H
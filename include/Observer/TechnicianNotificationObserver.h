@@ -8,27 +8,92 @@
 #include "Observer/InterventionObserver.h"
 #include "Business/NotificationSystem.h"
 #include <memory>
+#include <mutex>
+#include <deque>
+#include <ctime>
 
 /**
  * @class TechnicianNotificationObserver
  * @brief Observer that sends notifications to technicians
+ *
+ * Events addressed to a technician are routed directly to that technician.
+ * Events without a recipient are collected and broadcast as a single digest
+ * once per digest interval instead of one broadcast per event; the digest is
+ * sent from onTick() so it goes out even when no further event arrives. Only
+ * the count and the last MAX_DIGEST_LINES messages of a window are kept.
  */
 class TechnicianNotificationObserver : public InterventionObserver {
 private:
+    static constexpr size_t MAX_DIGEST_LINES = 10;
+
     std::shared_ptr<NotificationSystem> notificationSystem;
+    std::deque<std::string> pendingDigest;  // Last messages without a technician
+    size_t pendingCount;                    // Messages of the window, listed or not
+    int digestInterval;                     // In seconds
+    std::time_t digestWindowStart;
+    bool notifyTechnicians;                 // Forward the events addressed to a technician
+    mutable std::mutex digestMutex;         // onTick() runs on the scheduler thread
 
 public:
     /**
      * @brief Constructor
      * @param notificationSystem Shared pointer to the notification system
+     * @param digestInterval Seconds between two general digests (0 to broadcast immediately)
+     * @param notifyTechnicians Whether to forward the events addressed to a technician
+     *                          (false if the sender already notifies them)
+     */
+    explicit TechnicianNotificationObserver(std::shared_ptr<NotificationSystem> notificationSystem,
+                                            int digestInterval = 60, bool notifyTechnicians = true);
+
+    /**
+     * @brief Destructor - sends any pending digest
      */
-    explicit TechnicianNotificationObserver(std::shared_ptr<NotificationSystem> notificationSystem);
+    ~TechnicianNotificationObserver() override;
 
     /**
      * @brief Sends notifications to relevant technicians
      * @param message Message describing the event
+     * @note Legacy entry point: the technician is extracted from the text
      */
     void notify(const std::string& message) override;
+
+    /**
+     * @brief Sends notifications using the structured recipient data
+     * @param event Event with its routing data
+     */
+    void notifyEvent(const InterventionEvent& event) override;
+
+    /**
+     * @brief Broadcast the pending digest once its interval has elapsed
+     * @param now Current time
+     */
+    void onTick(std::time_t now) override;
+
+    /**
+     * @brief Broadcast the pending general notifications as one digest
+     * @return Number of messages included in the digest
+     */
+    size_t flushDigest();
+
+    /**
+     * @brief Get the number of messages waiting for the next digest
+     * @return Number of pending messages
+     */
+    size_t getPendingDigestSize() const;
+
+private:
+    /**
+     * @brief Route a message to a technician, or queue it for the digest
+     * @param technicianId ID of the technician (empty if none)
+     * @param message Message to send
+     */
+    void route(const std::string& technicianId, const std::string& message);
+
+    /**
+     * @brief Broadcast the pending digest (called with digestMutex held)
+     * @return Number of messages included in the digest
+     */
+    size_t flushDigestLocked();
 };
 
 #endif // TECHNICIAN_NOTIFICATION_OBSERVER_H
@@ -0,0 +1,150 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef ACCESS_AUDIT_LOG_H
+#define ACCESS_AUDIT_LOG_H
+
+#include "Observer/InterventionObserver.h"
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class AccessAuditLog
+ * @brief Buffered and sampled log of the access decisions of the proxy
+ *
+ * Recording an access only appends to a memory buffer; timestamps are
+ * formatted and the file is opened once per flush, when the buffer is full,
+ * when its oldest entry is older than the flush interval (checked on each
+ * record and by flushIfDue(), which an AuditLogFlusher calls from the
+ * manager's scheduler tick so quiet periods don't hold entries back), or on
+ * destruction.
+ * Denials are always kept; grants can be sampled one in N, so routine reads
+ * do not flood the log. Thread-safe.
+ */
+class AccessAuditLog {
+private:
+    struct Entry {
+        std::time_t time;
+        std::string userId;
+        const char* operation; // Static string
+        bool granted;
+    };
+
+    std::string filename;
+    size_t bufferSize;
+    int flushIntervalSeconds;
+    std::atomic<unsigned> grantSampling; // 0: no grants, N: one grant in N
+    std::atomic<bool> logDenials;
+    std::atomic<bool> echoDenials;       // Also print denials on the console
+    std::atomic<std::uint64_t> grantCounter;
+    std::atomic<std::uint64_t> sampledOut;
+
+    mutable std::mutex bufferMutex;
+    std::vector<Entry> buffer;
+
+    /**
+     * @brief Write the buffered entries (buffer mutex held)
+     */
+    void flushLocked();
+
+public:
+    /**
+     * @brief Constructor
+     * @param filename File the entries are appended to
+     * @param bufferSize Entries kept in memory before writing them
+     * @param flushIntervalSeconds Maximum age of a buffered entry
+     */
+    explicit AccessAuditLog(const std::string& filename = "access_log.txt", size_t bufferSize = 256,
+                            int flushIntervalSeconds = 5);
+
+    /**
+     * @brief Destructor, writes the buffered entries
+     */
+    ~AccessAuditLog();
+
+    AccessAuditLog(const AccessAuditLog&) = delete;
+    AccessAuditLog& operator=(const AccessAuditLog&) = delete;
+
+    /**
+     * @brief Record an access decision
+     * @param userId ID of the user
+     * @param operation Name of the operation (must be a static string)
+     * @param granted Whether access was granted
+     */
+    void record(const std::string& userId, const char* operation, bool granted);
+
+    /**
+     * @brief Write the buffered entries now
+     */
+    void flush();
+
+    /**
+     * @brief Write the buffered entries if the oldest one reached the flush interval
+     * @param now Current time
+     */
+    void flushIfDue(std::time_t now);
+
+    /**
+     * @brief Set how many grants are logged
+     * @param interval 1 logs every grant, N one grant in N, 0 none
+     */
+    void setGrantSampling(unsigned interval);
+
+    /**
+     * @brief Choose whether denials are logged
+     * @param enabled True to log every denial (the default)
+     */
+    void setLogDenials(bool enabled);
+
+    /**
+     * @brief Choose whether denials are also printed on the console
+     * @param enabled True to print them (the default)
+     */
+    void setEchoDenials(bool enabled);
+
+    /**
+     * @brief Get the number of entries waiting to be written
+     * @return Number of buffered entries
+     */
+    size_t getPendingCount() const;
+
+    /**
+     * @brief Get the number of grants left out by sampling
+     * @return Number of grants not logged
+     */
+    std::uint64_t getSampledOutCount() const;
+};
+
+/**
+ * @class AuditLogFlusher
+ * @brief Observer writing the audit entries that waited the flush interval
+ *
+ * Register one per audit log on the manager whose scheduler should flush it:
+ * a proxy does it for the log it creates, the owner of a log shared between
+ * proxies (e.g. InterventionDaemon) does it once for that log.
+ */
+class AuditLogFlusher : public InterventionObserver {
+private:
+    std::shared_ptr<AccessAuditLog> log;
+
+public:
+    /**
+     * @brief Constructor
+     * @param log The audit log to flush
+     */
+    explicit AuditLogFlusher(std::shared_ptr<AccessAuditLog> log);
+
+    void notify(const std::string& message) override;
+
+    bool isInterestedIn(const std::string& eventType) const override;
+
+    void onTick(std::time_t now) override;
+};
+
+#endif // ACCESS_AUDIT_LOG_H
@@ -0,0 +1,193 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef ACCESS_POLICY_H
+#define ACCESS_POLICY_H
+
+#include "Proxy/CapabilityToken.h"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class AccessPolicy
+ * @brief Roles, regions and user bindings the secure proxy resolves tokens from
+ *
+ * A role grants operations, some of them only on the interventions assigned
+ * to the user (e.g. a technician changing the status of their own jobs).
+ * A region is a named set of locations; a user bound to regions only acts on
+ * interventions located in them. Everything is compiled into masks when it
+ * is defined or loaded, so resolving a user gives a CapabilityToken and the
+ * proxy never evaluates rules per call.
+ */
+class AccessPolicy {
+public:
+    using Operation = CapabilityToken::Operation;
+    using RegionMask = CapabilityToken::RegionMask;
+
+    static constexpr size_t MAX_REGIONS = 64;
+
+    // Operations of the former access levels
+    static constexpr std::uint32_t READ_OPERATIONS =
+        CapabilityToken::bit(Operation::GET_INTERVENTION) |
+        CapabilityToken::bit(Operation::GET_INTERVENTION_INFO) |
+        CapabilityToken::bit(Operation::GET_INTERVENTIONS_FOR_DAY) |
+        CapabilityToken::bit(Operation::GET_INTERVENTION_COUNTS_FOR_MONTH) |
+        CapabilityToken::bit(Operation::FIND_FREE_SLOTS) |
+        CapabilityToken::bit(Operation::GET_TRAVEL_MINUTES) |
+        CapabilityToken::bit(Operation::GET_TRACK) |
+        CapabilityToken::bit(Operation::FIND_NEARBY) |
+        CapabilityToken::bit(Operation::GET_RECURRENCES);
+    static constexpr std::uint32_t MODIFY_OPERATIONS =
+        READ_OPERATIONS |
+        CapabilityToken::bit(Operation::MODIFY_INTERVENTION) |
+        CapabilityToken::bit(Operation::CHANGE_INTERVENTION_STATUS) |
+        CapabilityToken::bit(Operation::ASSIGN_TECHNICIAN) |
+        CapabilityToken::bit(Operation::DECORATE_WITH_GPS) |
+        CapabilityToken::bit(Operation::DECORATE_WITH_ATTACHMENTS) |
+        CapabilityToken::bit(Operation::ADD_GPS_COORDINATE) |
+        CapabilityToken::bit(Operation::ADD_GPS_COORDINATES) |
+        CapabilityToken::bit(Operation::ADD_ATTACHMENT) |
+        CapabilityToken::bit(Operation::PROPOSE_DISPATCH) |
+        CapabilityToken::bit(Operation::DISPATCH_EMERGENCY) |
+        CapabilityToken::bit(Operation::AUTO_ASSIGN_TECHNICIANS) |
+        CapabilityToken::bit(Operation::EDIT_SHIFT_CALENDAR) |
+        CapabilityToken::bit(Operation::LOAD_LOCATIONS) |
+        CapabilityToken::bit(Operation::SET_SITE_COORDINATES) |
+        CapabilityToken::bit(Operation::SET_GEOFENCE) |
+        CapabilityToken::bit(Operation::MANAGE_RECURRENCES);
+    static constexpr std::uint32_t FULL_OPERATIONS =
+        MODIFY_OPERATIONS |
+        CapabilityToken::bit(Operation::CREATE_INTERVENTION) |
+        CapabilityToken::bit(Operation::CREATE_EMERGENCY_INTERVENTION) |
+        CapabilityToken::bit(Operation::DELETE_INTERVENTION) |
+        CapabilityToken::bit(Operation::GET_REAL_MANAGER) |
+        CapabilityToken::bit(Operation::SET_USER_ACCESS_LEVEL);
+
+private:
+    struct Role {
+        std::uint32_t operations;
+        std::uint32_t ownOnly;
+    };
+
+    struct Binding {
+        std::string role;
+        RegionMask regions;
+        std::string technicianId;
+    };
+
+    std::map<std::string, Role> roles;
+    std::vector<std::string> regionNames;                                  // Region bit -> name
+    std::map<std::string, RegionMask, std::less<>> locationRegions;        // Location -> regions
+    std::map<std::string, Binding> bindings;                               // User ID -> binding
+
+    /**
+     * @brief Parse a comma-separated list of operations
+     * @param list Operation names (manager method names), "*" for all, with ":own" to require ownership
+     * @param operations Receives the operations
+     * @param ownOnly Receives the operations requiring ownership
+     * @return True if every name is known
+     */
+    static bool parseOperations(const std::string& list, std::uint32_t& operations, std::uint32_t& ownOnly);
+
+public:
+    /**
+     * @brief Create the default policy
+     * @return Roles admin (full), manager (modify), technician (read, plus status,
+     *         GPS points and attachments on their own interventions) and guest (read);
+     *         users admin, manager, technician and guest bound to the role of the same name
+     */
+    static AccessPolicy createDefault();
+
+    /**
+     * @brief Look up an operation by name
+     * @param name Name of the operation (manager method name)
+     * @param operation Receives the operation
+     * @return True if the name is known
+     */
+    static bool findOperation(std::string_view name, Operation& operation);
+
+    /**
+     * @brief Define or replace a role
+     * @param name Name of the role
+     * @param operations Operations the role grants (CapabilityToken::bit)
+     * @param ownOnly Operations granted only on the user's own interventions
+     */
+    void defineRole(const std::string& name, std::uint32_t operations, std::uint32_t ownOnly = 0);
+
+    /**
+     * @brief Check whether a role is defined
+     * @param name Name of the role
+     * @return True if it exists
+     */
+    bool hasRole(const std::string& name) const;
+
+    /**
+     * @brief Define a region, or get it if it exists
+     * @param name Name of the region
+     * @return Bit of the region, or -1 if MAX_REGIONS are already defined
+     */
+    int defineRegion(const std::string& name);
+
+    /**
+     * @brief Get the mask of regions by name
+     * @param names Names of the regions
+     * @return The mask, or 0 if a name is unknown
+     */
+    RegionMask getRegionMask(const std::vector<std::string>& names) const;
+
+    /**
+     * @brief Add a location to a region
+     * @param region Name of the region (defined if needed)
+     * @param location Location, as given to the interventions
+     * @return True if added
+     */
+    bool addLocation(const std::string& region, const std::string& location);
+
+    /**
+     * @brief Get the regions a location belongs to
+     * @param location The location
+     * @return Mask of the regions (0 if the location is in none)
+     */
+    RegionMask getLocationRegions(std::string_view location) const;
+
+    /**
+     * @brief Bind a user to a role, and optionally to regions and a technician ID
+     * @param userId ID of the user
+     * @param role Name of the role
+     * @param regions Regions the user acts in (ALL_REGIONS for any)
+     * @param technicianId Technician ID the user acts as (empty for the user ID)
+     * @return True if bound, false if the role is unknown
+     */
+    bool bindUser(const std::string& userId, const std::string& role,
+                  RegionMask regions = CapabilityToken::ALL_REGIONS, const std::string& technicianId = "");
+
+    /**
+     * @brief Load roles, regions and bindings from a file
+     * @param filename File of lines 'role;name;op[:own],...', 'region;name;location[;location...]'
+     *                 and 'user;id;role[;region,...|*[;technicianId]]'
+     * @return Number of lines loaded, or -1 if the file could not be opened
+     */
+    int load(const std::string& filename);
+
+    /**
+     * @brief Resolve the token of a user
+     * @param userId ID of the user
+     * @param role Role to use if the user has no binding (e.g. from authentication)
+     * @return The token, with no operation if neither a binding nor the role is known
+     */
+    CapabilityToken resolve(const std::string& userId, const std::string& role = "") const;
+
+    /**
+     * @brief Describe a token
+     * @param token The token
+     * @return Its operations, with their scope, and its regions
+     */
+    std::string describe(const CapabilityToken& token) const;
+};
+
+#endif // ACCESS_POLICY_H
@@ -0,0 +1,216 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef CAPABILITY_TOKEN_H
+#define CAPABILITY_TOKEN_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @class CapabilityToken
+ * @brief Immutable set of the operations a user may perform, resolved once
+ *
+ * The proxy resolves the user's access level into this bitmask when the
+ * user is bound to it (or their level changes), so checking an operation is
+ * a single bit test instead of a lookup by user name.
+ *
+ * A token can also scope operations to interventions: some only on the
+ * interventions assigned to the holder's technician ID, and all of them
+ * only within a set of regions. Only scoped operations need to look at the
+ * intervention; the others stay a single bit test.
+ */
+class CapabilityToken {
+public:
+    /**
+     * @brief Operations of the intervention manager guarded by the proxy
+     */
+    enum class Operation : std::uint8_t {
+        CREATE_INTERVENTION,
+        CREATE_EMERGENCY_INTERVENTION,
+        DELETE_INTERVENTION,
+        MODIFY_INTERVENTION,
+        CHANGE_INTERVENTION_STATUS,
+        ASSIGN_TECHNICIAN,
+        GET_INTERVENTION,
+        GET_INTERVENTION_INFO,
+        GET_INTERVENTIONS_FOR_DAY,
+        GET_INTERVENTION_COUNTS_FOR_MONTH,
+        GET_REAL_MANAGER,
+        DECORATE_WITH_GPS,
+        DECORATE_WITH_ATTACHMENTS,
+        ADD_GPS_COORDINATE,
+        ADD_GPS_COORDINATES,
+        ADD_ATTACHMENT,
+        SET_USER_ACCESS_LEVEL,
+        PROPOSE_DISPATCH,
+        DISPATCH_EMERGENCY,
+        AUTO_ASSIGN_TECHNICIANS,
+        FIND_FREE_SLOTS,
+        EDIT_SHIFT_CALENDAR,
+        GET_TRAVEL_MINUTES,
+        LOAD_LOCATIONS,
+        GET_TRACK,
+        SET_SITE_COORDINATES,
+        FIND_NEARBY,
+        SET_GEOFENCE,
+        MANAGE_RECURRENCES,
+        GET_RECURRENCES,
+        COUNT // Number of operations, not an operation
+    };
+
+    /**
+     * @brief Set of regions, one bit per region of the access policy
+     */
+    using RegionMask = std::uint64_t;
+
+    static constexpr RegionMask ALL_REGIONS = ~RegionMask(0);
+
+    /**
+     * @brief Bit of an operation in a token
+     * @param operation The operation
+     * @return The mask with only that operation
+     */
+    static constexpr std::uint32_t bit(Operation operation) {
+        return std::uint32_t(1) << static_cast<unsigned>(operation);
+    }
+
+    /**
+     * @brief Name of an operation, as written in the access log
+     * @param operation The operation
+     * @return The name (the manager method name)
+     */
+    static const char* getOperationName(Operation operation) {
+        static const char* const NAMES[] = {
+            "createIntervention", "createEmergencyIntervention", "deleteIntervention",
+            "modifyIntervention", "changeInterventionStatus", "assignTechnician",
+            "getIntervention", "getInterventionInfo", "getInterventionsForDay",
+            "getInterventionCountsForMonth", "getRealManager", "decorateWithGPS",
+            "decorateWithAttachments", "addGPSCoordinate", "addGPSCoordinates",
+            "addAttachment", "setUserAccessLevel", "proposeDispatch", "dispatchNextEmergency",
+            "autoAssignTechnicians", "findEarliestSlots", "addShiftEntry",
+            "getTravelMinutes", "loadLocations", "getTrack",
+            "setSiteCoordinates", "findNearby", "setGeofence",
+            "manageRecurrences", "getRecurrences"
+        };
+        static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == static_cast<size_t>(Operation::COUNT),
+                      "One name per operation");
+        return operation < Operation::COUNT ? NAMES[static_cast<size_t>(operation)] : "unknown";
+    }
+
+    /**
+     * @brief Operations that act on interventions, and can be limited to regions
+     * @return Mask of the operations
+     * @note Operations on technicians' time only are not limited
+     */
+    static constexpr std::uint32_t regionScopedOperations() {
+        const std::uint32_t all = (std::uint32_t(1) << static_cast<unsigned>(Operation::COUNT)) - 1;
+        return all & ~(bit(Operation::GET_REAL_MANAGER) | bit(Operation::SET_USER_ACCESS_LEVEL) |
+                       bit(Operation::FIND_FREE_SLOTS) | bit(Operation::EDIT_SHIFT_CALENDAR));
+    }
+
+private:
+    std::string userId;
+    std::uint32_t permitted;
+    std::uint32_t ownOnly;   // Permitted only on the holder's interventions
+    RegionMask regions;
+    std::uint32_t scoped;    // Operations that must look at the intervention
+    std::string technicianId;
+
+public:
+    /**
+     * @brief Constructor
+     * @param userId ID of the user holding the token
+     * @param permitted Mask of the permitted operations (bit())
+     * @param ownOnly Mask of the operations permitted only on the interventions assigned to technicianId
+     * @param regions Regions the operations on interventions are limited to
+     * @param technicianId Technician ID the user acts as (defaults to the user ID)
+     */
+    CapabilityToken(const std::string& userId, std::uint32_t permitted, std::uint32_t ownOnly = 0,
+                    RegionMask regions = ALL_REGIONS, const std::string& technicianId = "")
+        : userId(userId),
+          permitted(permitted),
+          ownOnly(ownOnly & permitted),
+          regions(regions),
+          scoped((ownOnly & permitted) | (regions != ALL_REGIONS ? permitted & regionScopedOperations() : 0)),
+          technicianId(technicianId.empty() ? userId : technicianId) {
+    }
+
+    /**
+     * @brief Get the user holding the token
+     * @return ID of the user
+     */
+    const std::string& getUserId() const {
+        return userId;
+    }
+
+    /**
+     * @brief Get the permitted operations
+     * @return Mask of the operations
+     */
+    std::uint32_t getPermitted() const {
+        return permitted;
+    }
+
+    /**
+     * @brief Get the operations permitted only on the holder's interventions
+     * @return Mask of the operations
+     */
+    std::uint32_t getOwnOnly() const {
+        return ownOnly;
+    }
+
+    /**
+     * @brief Get the regions the operations on interventions are limited to
+     * @return The regions (ALL_REGIONS if unrestricted)
+     */
+    RegionMask getRegions() const {
+        return regions;
+    }
+
+    /**
+     * @brief Get the technician ID the holder acts as
+     * @return The technician ID
+     */
+    const std::string& getTechnicianId() const {
+        return technicianId;
+    }
+
+    /**
+     * @brief Check whether an operation is permitted
+     * @param operation The operation
+     * @return True if the token allows it
+     */
+    bool allows(Operation operation) const {
+        return (permitted & bit(operation)) != 0;
+    }
+
+    /**
+     * @brief Check whether a permitted operation depends on the intervention it targets
+     * @param operation The operation
+     * @return True if allowsOn() must be checked as well
+     */
+    bool isScoped(Operation operation) const {
+        return (scoped & bit(operation)) != 0;
+    }
+
+    /**
+     * @brief Check a scoped operation against the intervention it targets
+     * @param operation The operation (permitted)
+     * @param assignedTechnician Technician assigned to the intervention
+     * @param locationRegions Regions of the intervention's location
+     * @return True if the token allows the operation on that intervention
+     */
+    bool allowsOn(Operation operation, std::string_view assignedTechnician, RegionMask locationRegions) const {
+        if ((ownOnly & bit(operation)) != 0 && assignedTechnician != technicianId) {
+            return false;
+        }
+        return regions == ALL_REGIONS || (regions & locationRegions) != 0;
+    }
+};
+
+static_assert(static_cast<unsigned>(CapabilityToken::Operation::COUNT) < 32, "Operations must fit the mask");
+
+#endif // CAPABILITY_TOKEN_H
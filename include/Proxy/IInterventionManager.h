@@ -12,6 +12,40 @@
 #include <memory>
 #include "Model/Intervention.h"
 #include "Model/Technician.h"
+#include "Business/TechnicianManager.h"
+#include "Business/TrackAnalytics.h"
+#include "Component/GPSTrackingComponent.h"
+#include "Business/RecurrenceEngine.h"
+
+/**
+ * @brief A GPS fix reported by a device for an intervention
+ */
+struct GPSSample {
+    int interventionId;
+    double latitude;
+    double longitude;
+    std::time_t timestamp;
+};
+
+/**
+ * @brief Technician proposed for the most urgent emergency
+ */
+struct DispatchProposal {
+    int interventionId = -1;     // Emergency to dispatch (-1 if the queue is empty)
+    std::string technicianId;    // Proposed technician (empty if nobody can take it)
+    double travelMinutes = -1;   // Travel time to the site (-1 if unknown)
+    std::vector<int> preempted;  // Maintenance interventions to bump
+};
+
+/**
+ * @brief Outcome of a bulk automatic assignment
+ */
+struct AutoAssignReport {
+    size_t considered = 0;    // Unassigned interventions at the start
+    size_t assigned = 0;      // Interventions that received a technician
+    int rounds = 0;           // Matching rounds applied
+    double totalTravelMinutes = 0; // Sum of the travel costs of the assignments
+};
 
 /**
  * @class IInterventionManager
@@ -40,6 +74,21 @@ public:
                                   std::time_t date,
                                   int duration) = 0;
 
+    /**
+     * @brief Create a new emergency intervention
+     * @param location Location of the intervention
+     * @param date Date and time of the intervention
+     * @param duration Expected duration in minutes
+     * @param priority Priority level (1-5)
+     * @param specialty Specialty required to handle it (empty if any)
+     * @return ID of the created intervention, or -1 if creation failed
+     */
+    virtual int createEmergencyIntervention(const std::string& location,
+                                            std::time_t date,
+                                            int duration,
+                                            int priority,
+                                            const std::string& specialty = "") = 0;
+
     /**
      * @brief Delete an intervention
      * @param interventionId ID of the intervention to delete
@@ -84,13 +133,25 @@ public:
      * @brief Get an intervention by ID
      * @param interventionId ID of the intervention
      * @return Pointer to the intervention, or nullptr if not found
+     * @note With several threads, use it under the manager's lockState() only
      */
     virtual const Intervention* getIntervention(int interventionId) const = 0;
 
+    /**
+     * @brief Get the details of an intervention, including its capabilities
+     * @param interventionId ID of the intervention
+     * @return Formatted details, or an empty string if not found
+     */
+    virtual std::string getInterventionInfo(int interventionId) const = 0;
+
     /**
      * @brief Get all interventions scheduled for a specific day
      * @param date Date to check
-     * @return Vector of intervention pointers
+     * @return Vector of intervention pointers, valid until the intervention is deleted
+     * @note Occurrences of recurring series not created yet are included with ID -1;
+     *       they stay valid until their series changes or the day leaves the cache
+     *       of recently listed days, so use them before the next listing.
+     *       With several threads, use them under the manager's lockState() only
      */
     virtual std::vector<const Intervention*> getInterventionsForDay(std::time_t date) const = 0;
 
@@ -99,13 +160,228 @@ public:
      * @param month Month (1-12)
      * @param year Year
      * @return Map of day number to intervention count
+     * @note Occurrences of recurring series not created yet are counted
      */
     virtual std::map<int, int> getInterventionCountsForMonth(int month, int year) const = 0;
 
     virtual bool decorateWithGPS(int interventionId) = 0;
     virtual bool decorateWithAttachments(int interventionId) = 0;
     virtual bool addGPSCoordinate(int interventionId, double latitude, double longitude) = 0;
+
+    /**
+     * @brief Add a batch of GPS fixes from any number of devices
+     * @param samples The fixes, in any order
+     * @return Number of fixes stored (fixes for unknown or untracked interventions are skipped)
+     */
+    virtual size_t addGPSCoordinates(const std::vector<GPSSample>& samples) = 0;
     virtual bool addAttachment(int interventionId, const std::string& filename, const std::string& description = "") = 0;
+
+    /**
+     * @brief Propose a technician for the most urgent unassigned emergency
+     * @param allowPreemption Whether scheduled maintenance may be bumped when nobody is free
+     * @return The proposal (technicianId is empty if nobody can take the job)
+     */
+    virtual DispatchProposal proposeDispatch(bool allowPreemption = true) const = 0;
+
+    /**
+     * @brief Assign the proposed technician to the most urgent emergency
+     * @param allowPreemption Whether scheduled maintenance may be bumped when nobody is free
+     * @return True if the emergency was dispatched
+     */
+    virtual bool dispatchNextEmergency(bool allowPreemption = true) = 0;
+
+    /**
+     * @brief Get the number of emergencies waiting for a technician
+     * @return Number of queued emergencies
+     */
+    virtual size_t getDispatchQueueSize() const = 0;
+
+    /**
+     * @brief Assign technicians to every unassigned scheduled intervention
+     * @param greedy Use the greedy baseline instead of the optimal matching
+     * @param maxRounds Maximum number of matching rounds
+     * @return Summary of the assignments made
+     */
+    virtual AutoAssignReport autoAssignTechnicians(bool greedy = false, int maxRounds = 8) = 0;
+
+    /**
+     * @brief Find the earliest free slots across technicians
+     * @param duration Duration of the slot in minutes
+     * @param specialty Optional specialty requirement
+     * @param notBefore Earliest allowed start
+     * @param horizon Latest allowed end
+     * @param count Maximum number of options to return
+     * @return Up to count (start, technician) options, earliest first
+     */
+    virtual std::vector<TechnicianManager::SlotOption> findEarliestSlots(int duration, const std::string& specialty,
+                                                                         std::time_t notBefore, std::time_t horizon,
+                                                                         size_t count = 1) const = 0;
+
+    /**
+     * @brief Add an entry to the shift calendar of a technician
+     * @param technicianId ID of the technician
+     * @param kind Kind of entry
+     * @param start Start of the entry
+     * @param end End of the entry
+     * @return True if the technician exists and the period is not empty
+     * @note Once a calendar exists the technician only works during its shifts
+     */
+    virtual bool addShiftEntry(const std::string& technicianId, ShiftCalendar::EntryKind kind,
+                               std::time_t start, std::time_t end) = 0;
+
+    /**
+     * @brief Count the working minutes of a technician in a period
+     * @param technicianId ID of the technician
+     * @param from Start of the period
+     * @param to End of the period
+     * @return Number of minutes, or -1 if the technician does not exist
+     */
+    virtual int getAvailableMinutes(const std::string& technicianId, std::time_t from, std::time_t to) const = 0;
+
+    /**
+     * @brief Load location coordinates from a gazetteer file
+     * @param filename File with one "name;latitude;longitude" entry per line
+     * @return Number of locations loaded, or -1 if the file could not be opened
+     */
+    virtual int loadGazetteer(const std::string& filename) = 0;
+
+    /**
+     * @brief Resolve unknown locations from the GPS history of their interventions
+     * @return Number of locations resolved
+     */
+    virtual int resolveLocationsFromTracking() = 0;
+
+    /**
+     * @brief Travel time between the locations of two interventions
+     * @param fromInterventionId ID of the origin intervention
+     * @param toInterventionId ID of the destination intervention
+     * @return Travel time in minutes, or -1 if a location is not resolved
+     */
+    virtual double getTravelMinutes(int fromInterventionId, int toInterventionId) = 0;
+
+    /**
+     * @brief Compute the analytics of a GPS-tracked intervention's track
+     * @param interventionId ID of the intervention
+     * @param summary Receives the analytics
+     * @param siteRadiusKm Radius around the site counted as "on site"
+     * @return True if the intervention exists and has GPS tracking
+     */
+    virtual bool getTrackSummary(int interventionId, TrackAnalytics::Summary& summary, double siteRadiusKm = 0.1) = 0;
+
+    /**
+     * @brief Get the GPS track of an intervention within a point budget
+     * @param interventionId ID of the intervention
+     * @param budget Maximum number of points
+     * @param points Receives the points
+     * @return True if the intervention exists and has GPS tracking
+     */
+    virtual bool getTrackPoints(int interventionId, size_t budget,
+                                std::vector<GPSTrackingComponent::GPSCoordinate>& points) = 0;
+
+    /**
+     * @brief Set the coordinates of an intervention site
+     * @param interventionId ID of the intervention
+     * @param latitude Latitude of the site
+     * @param longitude Longitude of the site
+     * @return True if the intervention exists
+     */
+    virtual bool setSiteCoordinates(int interventionId, double latitude, double longitude) = 0;
+
+    /**
+     * @brief Find the interventions whose site lies within a radius
+     * @param latitude Latitude of the center
+     * @param longitude Longitude of the center
+     * @param radiusKm Radius in kilometers
+     * @return (intervention ID, distance in km) pairs, nearest first
+     */
+    virtual std::vector<std::pair<int, double>> findInterventionsWithin(double latitude, double longitude,
+                                                                        double radiusKm) const = 0;
+
+    /**
+     * @brief Find the technicians whose last known position is nearest to a point
+     * @param latitude Latitude of the point
+     * @param longitude Longitude of the point
+     * @param count Maximum number of technicians
+     * @return (technician ID, distance in km) pairs, nearest first
+     */
+    virtual std::vector<std::pair<std::string, double>> findNearestTechnicians(double latitude, double longitude,
+                                                                               size_t count) const = 0;
+
+    /**
+     * @brief Set the radius of the geofence around an intervention site
+     * @param interventionId ID of the intervention
+     * @param radiusKm Radius in kilometers
+     * @return True if the site has coordinates and the radius is valid
+     */
+    virtual bool setGeofenceRadius(int interventionId, double radiusKm) = 0;
+
+    /**
+     * @brief Choose which status changes geofence crossings apply
+     * @param startOnArrival Set "In Progress" when the assigned technician arrives at a scheduled intervention
+     * @param completeOnDeparture Set "Completed" when the assigned technician leaves an intervention in progress
+     * @return True if the setting was changed
+     */
+    virtual bool setGeofenceAutoStatus(bool startOnArrival, bool completeOnDeparture) = 0;
+
+    /**
+     * @brief Create a recurring intervention
+     * @param type The intervention type
+     * @param location The location of every occurrence
+     * @param start Date and time of the first occurrence
+     * @param duration The duration in minutes
+     * @param rule The repetition pattern
+     * @return ID of the series, or -1 if creation failed
+     */
+    virtual int createRecurringIntervention(const std::string& type, const std::string& location,
+                                            std::time_t start, int duration, const RecurrenceRule& rule) = 0;
+
+    /**
+     * @brief Stop a recurring series
+     * @param seriesId ID of the series
+     * @return True if the series existed
+     */
+    virtual bool deleteRecurringSeries(int seriesId) = 0;
+
+    /**
+     * @brief Cancel one occurrence of a series (deleting it if already materialized)
+     * @param seriesId ID of the series
+     * @param index Index of the occurrence (0 for the first)
+     * @return True if the occurrence was cancelled
+     */
+    virtual bool cancelOccurrence(int seriesId, int index) = 0;
+
+    /**
+     * @brief Move one occurrence of a series (rescheduling it if already materialized)
+     * @param seriesId ID of the series
+     * @param index Index of the occurrence (0 for the first)
+     * @param date New date and time
+     * @return True if the occurrence was moved
+     */
+    virtual bool moveOccurrence(int seriesId, int index, std::time_t date) = 0;
+
+    /**
+     * @brief Set how far ahead occurrences are materialized
+     * @param days Number of days (at least 1)
+     * @return True if the horizon was changed
+     */
+    virtual bool setRecurrenceHorizon(int days) = 0;
+
+    /**
+     * @brief Describe a recurring series
+     * @param seriesId ID of the series
+     * @return Type, location, rule and missed occurrences, or an empty string if not found
+     */
+    virtual std::string getRecurringSeriesInfo(int seriesId) const = 0;
+
+    /**
+     * @brief Get the pending occurrences of a series in a window
+     * @param seriesId ID of the series
+     * @param from Start of the window
+     * @param to End of the window (excluded)
+     * @return The occurrences not materialized yet, in date order
+     */
+    virtual std::vector<RecurrenceEngine::Occurrence> getPendingOccurrences(int seriesId, std::time_t from,
+                                                                            std::time_t to) const = 0;
 };
 
 #endif // I_INTERVENTION_MANAGER_H
\ No newline at end of file
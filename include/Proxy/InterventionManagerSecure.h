@@ -7,6 +7,9 @@
 
 #include "Proxy/IInterventionManager.h"
 #include "Facade/InterventionManager.h"
+#include "Proxy/CapabilityToken.h"
+#include "Proxy/AccessAuditLog.h"
+#include "Proxy/AccessPolicy.h"
 #include <string>
 #include <map>
 #include <memory>
@@ -16,7 +19,11 @@
  * @brief Proxy that controls access to intervention management operations
  *
  * This proxy ensures that users have appropriate permissions before
- * allowing them to perform operations on interventions.
+ * allowing them to perform operations on interventions. The user's
+ * permissions are resolved once from an access policy into a capability
+ * token, so each call costs a bit test plus a record in the buffered audit
+ * log. Operations the token limits to the user's own interventions or to
+ * regions also look up the target intervention.
  */
 class InterventionManagerSecure : public IInterventionManager {
 public:
@@ -31,31 +38,97 @@ public:
     };
 
 private:
-    std::unique_ptr<InterventionManager> realManager;
+    std::shared_ptr<InterventionManager> realManager; // May be shared by the proxies of several sessions
     std::string currentUser;
-    std::map<std::string, AccessLevel> userAccessLevels;
+    std::map<std::string, AccessLevel> userAccessLevels; // Levels set explicitly, override the policy
+    std::shared_ptr<const AccessPolicy> policy;
+    CapabilityToken token;                   // Permissions of the current user
+    std::shared_ptr<AccessAuditLog> auditLog;
+    std::shared_ptr<AuditLogFlusher> auditFlusher; // Flushes the proxy's own log (null once shared)
 
     /**
-     * @brief Check if the current user has a required access level
-     * @param requiredLevel Minimum access level required
-     * @return True if user has sufficient access
+     * @brief Get the operations an access level permits
+     * @param level The access level
+     * @return Mask of the operations (CapabilityToken::bit)
      */
-    bool checkAccess(AccessLevel requiredLevel) const;
+    static std::uint32_t operationsFor(AccessLevel level);
 
     /**
-     * @brief Log an access attempt
+     * @brief Check whether the token allows a scoped operation on an intervention
      * @param operation Operation attempted
-     * @param granted Whether access was granted
+     * @param target The intervention
+     * @return True if allowed
      */
-    void logAccessAttempt(const std::string& operation, bool granted) const;
+    bool allowsOn(CapabilityToken::Operation operation, const Intervention& target) const;
+
+    /**
+     * @brief Check an operation against the current user's token and audit the decision
+     * @param operation Operation attempted
+     * @return True if access is granted
+     */
+    bool authorize(CapabilityToken::Operation operation) const;
+
+    /**
+     * @brief Check an operation on an existing intervention and audit the decision
+     * @param operation Operation attempted
+     * @param interventionId ID of the intervention
+     * @return True if access is granted
+     * @note Callers hold the manager's lockState() from the check to the end of the
+     *       operation, so the intervention checked is the one acted on
+     */
+    bool authorize(CapabilityToken::Operation operation, int interventionId) const;
+
+    /**
+     * @brief Check an operation at a location (creation, move) and audit the decision
+     * @param operation Operation attempted
+     * @param location Location of the intervention
+     * @return True if access is granted
+     */
+    bool authorizeAt(CapabilityToken::Operation operation, const std::string& location) const;
+
+    /**
+     * @brief Check an operation over every intervention and audit the decision
+     * @param operation Operation attempted
+     * @return True if access is granted
+     * @note Refused to tokens limiting the operation to some interventions
+     */
+    bool authorizeGlobal(CapabilityToken::Operation operation) const;
+
+    /**
+     * @brief Check an operation on a recurring series and audit the decision
+     * @param operation Operation attempted
+     * @param seriesId ID of the series
+     * @return True if access is granted
+     * @note Scoped operations look at the series' prototype; callers hold lockState()
+     */
+    bool authorizeSeries(CapabilityToken::Operation operation, int seriesId) const;
 
 public:
     /**
-     * @brief Constructor
+     * @brief Constructor, with the default access policy
      * @param currentUser ID of the current user
      */
     explicit InterventionManagerSecure(const std::string& currentUser);
 
+    /**
+     * @brief Constructor
+     * @param currentUser ID of the current user
+     * @param policy Access policy the user's token is resolved from
+     * @param role Role of the user if the policy has no binding for them
+     */
+    InterventionManagerSecure(const std::string& currentUser, std::shared_ptr<const AccessPolicy> policy,
+                              const std::string& role = "");
+
+    /**
+     * @brief Constructor, over an existing manager
+     * @param currentUser ID of the current user
+     * @param manager Manager to protect, shared with other proxies (must be non-null)
+     * @param policy Access policy the user's token is resolved from
+     * @param role Role of the user if the policy has no binding for them
+     */
+    InterventionManagerSecure(const std::string& currentUser, std::shared_ptr<InterventionManager> manager,
+                              std::shared_ptr<const AccessPolicy> policy, const std::string& role = "");
+
     /**
      * @brief Set access level for a user
      * @param userId ID of the user
@@ -65,16 +138,48 @@ public:
 
     /**
      * @brief Get access level for the current user
-     * @return Current user's access level
+     * @return Current user's access level (the highest level their token fully covers)
      */
     AccessLevel getCurrentUserAccessLevel() const;
 
+    /**
+     * @brief Get the capability token of the current user
+     * @return The token
+     */
+    const CapabilityToken& getToken() const;
+
+    /**
+     * @brief Get the access policy
+     * @return The policy
+     */
+    std::shared_ptr<const AccessPolicy> getPolicy() const;
+
+    /**
+     * @brief Replace the audit log (e.g. to share one between proxies)
+     * @param log The audit log (ignored if null)
+     *
+     * The owner of a shared log flushes it by registering an AuditLogFlusher.
+     */
+    void setAuditLog(std::shared_ptr<AccessAuditLog> log);
+
+    /**
+     * @brief Get the audit log, to configure its sampling
+     * @return The audit log
+     */
+    std::shared_ptr<AccessAuditLog> getAuditLog() const;
+
     // IInterventionManager interface implementation
     int createIntervention(const std::string& type,
                           const std::string& location,
                           std::time_t date,
                           int duration) override;
 
+    int createEmergencyIntervention(const std::string& location,
+                                    std::time_t date,
+                                    int duration,
+                                    int priority,
+                                    const std::string& specialty = "") override;
+
     bool deleteIntervention(int interventionId) override;
 
     bool modifyIntervention(int interventionId,
@@ -91,6 +196,8 @@ public:
 
     const Intervention* getIntervention(int interventionId) const override;
 
+    std::string getInterventionInfo(int interventionId) const override;
+
     std::vector<const Intervention*> getInterventionsForDay(std::time_t date) const override;
 
     std::map<int, int> getInterventionCountsForMonth(int month, int year) const override;
@@ -108,9 +215,72 @@ public:
 
     bool addGPSCoordinate(int interventionId, double latitude, double longitude) override;
 
+    size_t addGPSCoordinates(const std::vector<GPSSample>& samples) override;
+
     bool addAttachment(int interventionId, const std::string &filename, const std::string &description) override;
 
-    virtual ~InterventionManagerSecure() = default;
+    DispatchProposal proposeDispatch(bool allowPreemption = true) const override;
+
+    bool dispatchNextEmergency(bool allowPreemption = true) override;
+
+    size_t getDispatchQueueSize() const override;
+
+    AutoAssignReport autoAssignTechnicians(bool greedy = false, int maxRounds = 8) override;
+
+    std::vector<TechnicianManager::SlotOption> findEarliestSlots(int duration, const std::string& specialty,
+                                                                 std::time_t notBefore, std::time_t horizon,
+                                                                 size_t count = 1) const override;
+
+    bool addShiftEntry(const std::string& technicianId, ShiftCalendar::EntryKind kind,
+                       std::time_t start, std::time_t end) override;
+
+    int getAvailableMinutes(const std::string& technicianId, std::time_t from, std::time_t to) const override;
+
+    int loadGazetteer(const std::string& filename) override;
+
+    int resolveLocationsFromTracking() override;
+
+    double getTravelMinutes(int fromInterventionId, int toInterventionId) override;
+
+    bool getTrackSummary(int interventionId, TrackAnalytics::Summary& summary, double siteRadiusKm = 0.1) override;
+
+    bool getTrackPoints(int interventionId, size_t budget, std::vector<GPSTrackingComponent::GPSCoordinate>& points) override;
+
+    bool setSiteCoordinates(int interventionId, double latitude, double longitude) override;
+
+    std::vector<std::pair<int, double>> findInterventionsWithin(double latitude, double longitude,
+                                                                double radiusKm) const override;
+
+    std::vector<std::pair<std::string, double>> findNearestTechnicians(double latitude, double longitude,
+                                                                       size_t count) const override;
+
+    bool setGeofenceRadius(int interventionId, double radiusKm) override;
+
+    bool setGeofenceAutoStatus(bool startOnArrival, bool completeOnDeparture) override;
+
+    int createRecurringIntervention(const std::string& type, const std::string& location,
+                                    std::time_t start, int duration, const RecurrenceRule& rule) override;
+
+    bool deleteRecurringSeries(int seriesId) override;
+
+    bool cancelOccurrence(int seriesId, int index) override;
+
+    bool moveOccurrence(int seriesId, int index, std::time_t date) override;
+
+    bool setRecurrenceHorizon(int days) override;
+
+    std::string getRecurringSeriesInfo(int seriesId) const override;
+
+    std::vector<RecurrenceEngine::Occurrence> getPendingOccurrences(int seriesId, std::time_t from,
+                                                                    std::time_t to) const override;
+
+    /**
+     * @brief Destructor, stops flushing the audit log from the manager's scheduler
+     */
+    virtual ~InterventionManagerSecure();
+
+    InterventionManagerSecure(const InterventionManagerSecure&) = delete;
+    InterventionManagerSecure& operator=(const InterventionManagerSecure&) = delete;
 };
 
 #endif // INTERVENTION_MANAGER_SECURE_H
\ No newline at end of file
@@ -0,0 +1,209 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#ifndef INTERVENTION_DAEMON_H
+#define INTERVENTION_DAEMON_H
+
+#include "Proxy/InterventionManagerSecure.h"
+#include "CLI/AuthenticationSystem.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class InterventionDaemon
+ * @brief Multi-session server sharing one intervention manager over a UNIX socket
+ *
+ * Each client connection is a session: after "login" it gets its own secure
+ * proxy bound to the user, over the manager shared by every session, and a
+ * shared audit log. One event loop (poll) accepts connections, reads request
+ * lines and writes responses; a pool of workers executes the requests. The
+ * requests of a session run one at a time and in order, so clients may
+ * pipeline them; different sessions run in parallel.
+ *
+ * Protocol: one request per line, arguments separated by spaces (double
+ * quotes group words), dates as UNIX timestamps. A response is "OK [text]"
+ * or "ERR <reason>" on one line; "OK <n>" announces n more lines for
+ * listings. Send "help" for the list of requests. POSIX only.
+ */
+class InterventionDaemon {
+public:
+    /**
+     * @brief Counters of the daemon
+     */
+    struct Stats {
+        size_t sessionsOpened = 0;
+        size_t activeSessions = 0;
+        size_t requests = 0;
+    };
+
+private:
+    struct Session {
+        std::uint64_t id;
+        int fd;
+        std::string input;                 // Received, not yet split into lines
+        std::string output;                // Responses not yet written
+        std::deque<std::string> pending;   // Requests waiting for the previous one
+        bool busy = false;                 // A worker runs one of its requests
+        bool closing = false;              // Close once the output is written
+        bool disconnected = false;         // The peer is gone
+
+        // Only used by the worker running the session's request
+        std::string user;
+        std::unique_ptr<InterventionManagerSecure> proxy;
+    };
+
+    struct Task {
+        std::uint64_t sessionId;
+        Session* session;
+        std::string request;
+    };
+
+    struct Completion {
+        std::uint64_t sessionId;
+        std::string response;
+        bool close;
+    };
+
+    static constexpr size_t MAX_REQUEST_LENGTH = 64 * 1024;
+
+    std::string socketPath;
+    std::shared_ptr<InterventionManager> manager;
+    std::shared_ptr<const AccessPolicy> policy;
+    std::shared_ptr<AccessAuditLog> auditLog;
+    std::shared_ptr<AuditLogFlusher> auditFlusher; // One for every session's proxy
+    AuthenticationSystem authSystem;   // Only used through its const methods
+    size_t workerCount;
+
+    int listenFd;
+    int wakeFds[2];                    // Self-pipe: workers and stop() wake the event loop
+    std::atomic<bool> stopping;
+
+    // Event loop state
+    std::map<std::uint64_t, std::unique_ptr<Session>> sessions;
+    std::uint64_t nextSessionId;
+
+    // Worker pool
+    std::vector<std::thread> workers;
+    std::deque<Task> tasks;
+    std::mutex tasksMutex;
+    std::condition_variable tasksReady;
+
+    std::vector<Completion> completions;
+    std::mutex completionsMutex;
+
+    mutable std::mutex statsMutex;
+    Stats stats;
+
+    /**
+     * @brief Wake the event loop (async-signal-safe)
+     */
+    void wake();
+
+    /**
+     * @brief Worker thread body
+     */
+    void runWorker();
+
+    /**
+     * @brief Accept the pending connections
+     */
+    void acceptSessions();
+
+    /**
+     * @brief Read from a session and queue its complete request lines
+     * @param session The session
+     */
+    void readSession(Session& session);
+
+    /**
+     * @brief Write the pending output of a session
+     * @param session The session
+     */
+    void writeSession(Session& session);
+
+    /**
+     * @brief Hand the next request of an idle session to the workers
+     * @param session The session
+     */
+    void dispatchNext(Session& session);
+
+    /**
+     * @brief Apply the responses produced by the workers
+     */
+    void collectCompletions();
+
+    /**
+     * @brief Execute a request (worker thread)
+     * @param session The session the request belongs to
+     * @param request The request line
+     * @param close Set to true if the session must be closed after the response
+     * @return The response, newline-terminated
+     */
+    std::string handleRequest(Session& session, const std::string& request, bool& close);
+
+public:
+    /**
+     * @brief Constructor
+     * @param socketPath Path of the UNIX socket to listen on
+     * @param manager Manager shared by every session (created if null)
+     * @param policy Access policy of the sessions (the default one if null)
+     * @param workerCount Number of worker threads (0 for one per core)
+     */
+    explicit InterventionDaemon(const std::string& socketPath,
+                                std::shared_ptr<InterventionManager> manager = nullptr,
+                                std::shared_ptr<const AccessPolicy> policy = nullptr,
+                                size_t workerCount = 0);
+
+    /**
+     * @brief Destructor, stops the workers and removes the socket
+     */
+    ~InterventionDaemon();
+
+    InterventionDaemon(const InterventionDaemon&) = delete;
+    InterventionDaemon& operator=(const InterventionDaemon&) = delete;
+
+    /**
+     * @brief Bind the socket and start the workers
+     * @return True if the daemon is ready to run
+     */
+    bool start();
+
+    /**
+     * @brief Run the event loop until stop() is called
+     */
+    void run();
+
+    /**
+     * @brief Ask the event loop to return (thread and async-signal-safe)
+     */
+    void stop();
+
+    /**
+     * @brief Get the shared manager
+     * @return The manager
+     */
+    std::shared_ptr<InterventionManager> getManager() const;
+
+    /**
+     * @brief Get the audit log shared by the sessions
+     * @return The audit log
+     */
+    std::shared_ptr<AccessAuditLog> getAuditLog() const;
+
+    /**
+     * @brief Get the counters
+     * @return Copy of the counters
+     */
+    Stats getStats() const;
+};
+
+#endif // INTERVENTION_DAEMON_H
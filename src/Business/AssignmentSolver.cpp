@@ -0,0 +1,172 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/AssignmentSolver.h"
+#include <thread>
+#include <limits>
+#include <algorithm>
+
+AssignmentSolver::CostMatrix AssignmentSolver::buildCostMatrix(size_t rows, size_t cols,
+                                                               const std::function<double(size_t, size_t)>& cost,
+                                                               unsigned threads) {
+    CostMatrix matrix;
+    matrix.rows = rows;
+    matrix.cols = cols;
+    matrix.costs.resize(rows * cols);
+
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Small matrices are not worth the thread start-up cost
+    const size_t MIN_ROWS_PER_THREAD = 64;
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(1, rows / MIN_ROWS_PER_THREAD)));
+
+    auto fillRows = [&matrix, &cost](size_t first, size_t last) {
+        for (size_t row = first; row < last; ++row) {
+            double* out = &matrix.costs[row * matrix.cols];
+            for (size_t col = 0; col < matrix.cols; ++col) {
+                out[col] = std::min(cost(row, col), FORBIDDEN);
+            }
+        }
+    };
+
+    if (threads <= 1) {
+        fillRows(0, rows);
+        return matrix;
+    }
+
+    // Each thread fills a contiguous block of rows
+    std::vector<std::thread> workers;
+    size_t blockSize = (rows + threads - 1) / threads;
+    for (size_t first = 0; first < rows; first += blockSize) {
+        workers.emplace_back(fillRows, first, std::min(rows, first + blockSize));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    return matrix;
+}
+
+std::vector<int> AssignmentSolver::solveOptimal(const CostMatrix& matrix) {
+    std::vector<int> matching(matrix.rows, -1);
+    if (matrix.rows == 0 || matrix.cols == 0) {
+        return matching;
+    }
+
+    // The algorithm needs at least as many columns as rows: solve the transpose otherwise
+    bool transposed = matrix.rows > matrix.cols;
+    size_t n = transposed ? matrix.cols : matrix.rows;
+    size_t m = transposed ? matrix.rows : matrix.cols;
+    auto cost = [&matrix, transposed](size_t i, size_t j) {
+        return transposed ? matrix.at(j, i) : matrix.at(i, j);
+    };
+
+    const double INF = std::numeric_limits<double>::infinity();
+
+    // Potentials and matching, 1-based with column 0 as the virtual source
+    std::vector<double> u(n + 1, 0), v(m + 1, 0), minv(m + 1);
+    std::vector<size_t> p(m + 1, 0), way(m + 1, 0);
+    std::vector<char> used(m + 1);
+    std::vector<double> rowCosts(m);
+
+    for (size_t i = 1; i <= n; ++i) {
+        p[0] = i;
+        size_t j0 = 0;
+        std::fill(minv.begin(), minv.end(), INF);
+        std::fill(used.begin(), used.end(), 0);
+
+        // Grow a shortest path tree from row i until it reaches a free column
+        do {
+            used[j0] = 1;
+            size_t i0 = p[j0];
+            double delta = INF;
+            size_t j1 = 0;
+
+            if (transposed) {
+                for (size_t j = 1; j <= m; ++j) {
+                    rowCosts[j - 1] = cost(i0 - 1, j - 1);
+                }
+            }
+            const double* row = transposed ? rowCosts.data() : &matrix.costs[(i0 - 1) * matrix.cols];
+
+            for (size_t j = 1; j <= m; ++j) {
+                if (used[j]) {
+                    continue;
+                }
+                double reduced = row[j - 1] - u[i0] - v[j];
+                if (reduced < minv[j]) {
+                    minv[j] = reduced;
+                    way[j] = j0;
+                }
+                if (minv[j] < delta) {
+                    delta = minv[j];
+                    j1 = j;
+                }
+            }
+
+            for (size_t j = 0; j <= m; ++j) {
+                if (used[j]) {
+                    u[p[j]] += delta;
+                    v[j] -= delta;
+                } else {
+                    minv[j] -= delta;
+                }
+            }
+            j0 = j1;
+        } while (p[j0] != 0);
+
+        // Flip the matching along the augmenting path
+        do {
+            size_t j1 = way[j0];
+            p[j0] = p[j1];
+            j0 = j1;
+        } while (j0 != 0);
+    }
+
+    // Forbidden pairs picked to complete the matching are left unmatched
+    for (size_t j = 1; j <= m; ++j) {
+        if (p[j] == 0) {
+            continue;
+        }
+        size_t row = transposed ? j - 1 : p[j] - 1;
+        size_t col = transposed ? p[j] - 1 : j - 1;
+        if (matrix.at(row, col) < FORBIDDEN) {
+            matching[row] = static_cast<int>(col);
+        }
+    }
+
+    return matching;
+}
+
+std::vector<int> AssignmentSolver::solveGreedy(const CostMatrix& matrix) {
+    std::vector<int> matching(matrix.rows, -1);
+    std::vector<char> taken(matrix.cols, 0);
+
+    for (size_t row = 0; row < matrix.rows; ++row) {
+        double best = FORBIDDEN;
+        for (size_t col = 0; col < matrix.cols; ++col) {
+            if (!taken[col] && matrix.at(row, col) < best) {
+                best = matrix.at(row, col);
+                matching[row] = static_cast<int>(col);
+            }
+        }
+        if (matching[row] != -1) {
+            taken[matching[row]] = 1;
+        }
+    }
+
+    return matching;
+}
+
+double AssignmentSolver::totalCost(const CostMatrix& matrix, const std::vector<int>& matching) {
+    double total = 0;
+    for (size_t row = 0; row < matching.size() && row < matrix.rows; ++row) {
+        if (matching[row] >= 0) {
+            total += matrix.at(row, static_cast<size_t>(matching[row]));
+        }
+    }
+    return total;
+}
@@ -0,0 +1,289 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/CompressedTrack.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+std::uint64_t zigzag(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+std::int64_t unzigzag(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+unsigned bitWidth(std::uint64_t value) {
+    unsigned width = 0;
+    while (value != 0) {
+        value >>= 1;
+        ++width;
+    }
+    return width;
+}
+
+// Appends fixed-width values to a word array
+class BitWriter {
+    std::vector<std::uint64_t>& words;
+    unsigned used;
+
+public:
+    explicit BitWriter(std::vector<std::uint64_t>& out) : words(out), used(64) {}
+
+    void put(std::uint64_t value, unsigned width) {
+        if (width == 0) {
+            return;
+        }
+        if (used == 64) {
+            words.push_back(0);
+            used = 0;
+        }
+
+        words.back() |= value << used;
+        if (used + width > 64) {
+            words.push_back(value >> (64 - used));
+            used = used + width - 64;
+        } else {
+            used += width;
+        }
+    }
+};
+
+class BitReader {
+    const std::vector<std::uint64_t>& words;
+    size_t word;
+    unsigned offset;
+
+public:
+    explicit BitReader(const std::vector<std::uint64_t>& in) : words(in), word(0), offset(0) {}
+
+    std::uint64_t get(unsigned width) {
+        if (width == 0) {
+            return 0;
+        }
+
+        std::uint64_t value = words[word] >> offset;
+        if (offset + width > 64) {
+            value |= words[word + 1] << (64 - offset);
+        }
+        if (width < 64) {
+            value &= (std::uint64_t(1) << width) - 1;
+        }
+
+        offset += width;
+        if (offset >= 64) {
+            offset -= 64;
+            ++word;
+        }
+        return value;
+    }
+};
+
+} // namespace
+
+CompressedTrack::CompressedTrack() : lastPoint{0, 0, 0}, pointCount(0), chronological(true) {
+    tail.reserve(BLOCK_SIZE);
+}
+
+void CompressedTrack::append(double latitude, double longitude, std::time_t timestamp) {
+    RawPoint raw{static_cast<std::int64_t>(timestamp),
+                 static_cast<std::int64_t>(std::llround(latitude * COORDINATE_SCALE)),
+                 static_cast<std::int64_t>(std::llround(longitude * COORDINATE_SCALE))};
+
+    if (pointCount > 0 && raw.time < lastPoint.time) {
+        chronological = false;
+    }
+
+    tail.push_back(raw);
+    lastPoint = raw;
+    pointCount++;
+
+    if (tail.size() == BLOCK_SIZE) {
+        sealTail();
+    }
+}
+
+void CompressedTrack::sealTail() {
+    Block block;
+    block.first = tail.front();
+    block.count = static_cast<std::uint16_t>(tail.size());
+    block.minTime = block.maxTime = tail.front().time;
+    for (const auto& raw : tail) {
+        block.minTime = std::min(block.minTime, raw.time);
+        block.maxTime = std::max(block.maxTime, raw.time);
+    }
+
+    // Zig-zag deltas and deltas of deltas of each channel
+    size_t n = tail.size();
+    std::array<std::vector<std::uint64_t>, 3> encoded;
+    for (int channel = 0; channel < 3; ++channel) {
+        auto valueOf = [channel](const RawPoint& raw) {
+            return channel == 0 ? raw.time : (channel == 1 ? raw.lat : raw.lon);
+        };
+
+        std::vector<std::uint64_t> deltas, deltaOfDeltas;
+        std::uint64_t maxDelta = 0, maxDeltaOfDelta = 0;
+        std::int64_t previousDelta = 0;
+        for (size_t i = 1; i < n; ++i) {
+            std::int64_t delta = valueOf(tail[i]) - valueOf(tail[i - 1]);
+            deltas.push_back(zigzag(delta));
+            maxDelta = std::max(maxDelta, deltas.back());
+
+            if (i == 1) {
+                block.firstDelta[channel] = delta;
+            } else {
+                deltaOfDeltas.push_back(zigzag(delta - previousDelta));
+                maxDeltaOfDelta = std::max(maxDeltaOfDelta, deltaOfDeltas.back());
+            }
+            previousDelta = delta;
+        }
+
+        if (n > 1 && bitWidth(maxDeltaOfDelta) < bitWidth(maxDelta)) {
+            block.deltaOfDelta[channel] = 1;
+            block.width[channel] = static_cast<std::uint8_t>(bitWidth(maxDeltaOfDelta));
+            encoded[channel] = std::move(deltaOfDeltas);
+        } else {
+            block.deltaOfDelta[channel] = 0;
+            block.width[channel] = static_cast<std::uint8_t>(bitWidth(maxDelta));
+            encoded[channel] = std::move(deltas);
+        }
+    }
+
+    // Interleave the channels point by point, in the order the decoder reads them
+    BitWriter writer(block.bits);
+    for (size_t i = 1; i < n; ++i) {
+        for (int channel = 0; channel < 3; ++channel) {
+            if (!block.deltaOfDelta[channel]) {
+                writer.put(encoded[channel][i - 1], block.width[channel]);
+            } else if (i > 1) {
+                writer.put(encoded[channel][i - 2], block.width[channel]);
+            }
+        }
+    }
+    block.bits.shrink_to_fit();
+
+    blocks.push_back(std::move(block));
+    tail.clear();
+}
+
+void CompressedTrack::decodeBlock(const Block& block, std::vector<RawPoint>& out) {
+    RawPoint current = block.first;
+    out.push_back(current);
+
+    std::array<std::int64_t, 3> delta = block.firstDelta;
+    BitReader reader(block.bits);
+    for (size_t i = 1; i < block.count; ++i) {
+        // Deltas-of-deltas channels have one value fewer: the seed is in the header
+        std::array<std::int64_t, 3> step;
+        for (int channel = 0; channel < 3; ++channel) {
+            if (block.deltaOfDelta[channel]) {
+                if (i > 1) {
+                    delta[channel] += unzigzag(reader.get(block.width[channel]));
+                }
+                step[channel] = delta[channel];
+            } else {
+                step[channel] = unzigzag(reader.get(block.width[channel]));
+            }
+        }
+
+        current.time += step[0];
+        current.lat += step[1];
+        current.lon += step[2];
+        out.push_back(current);
+    }
+}
+
+TrackPoint CompressedTrack::toPoint(const RawPoint& raw) {
+    return TrackPoint(static_cast<double>(raw.lat) / COORDINATE_SCALE,
+                      static_cast<double>(raw.lon) / COORDINATE_SCALE,
+                      static_cast<std::time_t>(raw.time));
+}
+
+size_t CompressedTrack::size() const {
+    return pointCount;
+}
+
+bool CompressedTrack::empty() const {
+    return pointCount == 0;
+}
+
+TrackPoint CompressedTrack::back() const {
+    return toPoint(lastPoint);
+}
+
+std::vector<TrackPoint> CompressedTrack::decodeAll() const {
+    std::vector<TrackPoint> points;
+    points.reserve(pointCount);
+
+    std::vector<RawPoint> decoded;
+    decoded.reserve(BLOCK_SIZE);
+    for (const auto& block : blocks) {
+        decoded.clear();
+        decodeBlock(block, decoded);
+        for (const auto& raw : decoded) {
+            points.push_back(toPoint(raw));
+        }
+    }
+    for (const auto& raw : tail) {
+        points.push_back(toPoint(raw));
+    }
+
+    return points;
+}
+
+std::vector<TrackPoint> CompressedTrack::decodeRange(std::time_t from, std::time_t to) const {
+    std::vector<TrackPoint> points;
+    std::int64_t low = static_cast<std::int64_t>(from);
+    std::int64_t high = static_cast<std::int64_t>(to);
+    if (high < low) {
+        return points;
+    }
+
+    // Chronological tracks can skip straight to the first overlapping block
+    auto blockIt = blocks.begin();
+    if (chronological) {
+        blockIt = std::lower_bound(blocks.begin(), blocks.end(), low,
+                                   [](const Block& block, std::int64_t time) { return block.maxTime < time; });
+    }
+
+    std::vector<RawPoint> decoded;
+    decoded.reserve(BLOCK_SIZE);
+    for (; blockIt != blocks.end(); ++blockIt) {
+        if (blockIt->minTime > high) {
+            if (chronological) {
+                break;
+            }
+            continue;
+        }
+        if (blockIt->maxTime < low) {
+            continue;
+        }
+
+        decoded.clear();
+        decodeBlock(*blockIt, decoded);
+        for (const auto& raw : decoded) {
+            if (raw.time >= low && raw.time <= high) {
+                points.push_back(toPoint(raw));
+            }
+        }
+    }
+
+    for (const auto& raw : tail) {
+        if (raw.time >= low && raw.time <= high) {
+            points.push_back(toPoint(raw));
+        }
+    }
+
+    return points;
+}
+
+size_t CompressedTrack::getMemoryUsage() const {
+    size_t bytes = sizeof(*this) + blocks.capacity() * sizeof(Block) + tail.capacity() * sizeof(RawPoint);
+    for (const auto& block : blocks) {
+        bytes += block.bits.capacity() * sizeof(std::uint64_t);
+    }
+    return bytes;
+}
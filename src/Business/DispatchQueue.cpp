@@ -0,0 +1,149 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/DispatchQueue.h"
+#include <queue>
+#include <utility>
+
+DispatchQueue::DispatchQueue() : nextSequence(0) {
+}
+
+void DispatchQueue::push(int interventionId, int priority, const std::string& specialty, std::time_t createdAt) {
+    auto it = positions.find(interventionId);
+    if (it != positions.end()) {
+        // Already queued: keep its age, refresh the rest
+        heap[it->second].specialty = specialty;
+        updatePriority(interventionId, priority);
+        return;
+    }
+
+    heap.push_back(Job{interventionId, priority, createdAt, nextSequence++, specialty});
+    positions[interventionId] = heap.size() - 1;
+    siftUp(heap.size() - 1);
+}
+
+bool DispatchQueue::remove(int interventionId) {
+    auto it = positions.find(interventionId);
+    if (it == positions.end()) {
+        return false;
+    }
+
+    size_t index = it->second;
+    size_t last = heap.size() - 1;
+
+    if (index != last) {
+        swapNodes(index, last);
+    }
+    heap.pop_back();
+    positions.erase(interventionId);
+
+    // Restore the heap property for the job moved into the hole
+    if (index < heap.size()) {
+        siftUp(index);
+        siftDown(index);
+    }
+    return true;
+}
+
+bool DispatchQueue::updatePriority(int interventionId, int priority) {
+    auto it = positions.find(interventionId);
+    if (it == positions.end()) {
+        return false;
+    }
+
+    size_t index = it->second;
+    heap[index].priority = priority;
+    siftUp(index);
+    siftDown(positions[interventionId]);
+    return true;
+}
+
+const DispatchQueue::Job* DispatchQueue::top() const {
+    return heap.empty() ? nullptr : &heap.front();
+}
+
+void DispatchQueue::visitInOrder(const std::function<bool(const Job&)>& visit) const {
+    // Frontier of heap indices: a child can only come out after its parent
+    auto lessUrgent = [this](size_t a, size_t b) { return moreUrgent(heap[b], heap[a]); };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(lessUrgent)> frontier(lessUrgent);
+
+    if (!heap.empty()) {
+        frontier.push(0);
+    }
+
+    while (!frontier.empty()) {
+        size_t index = frontier.top();
+        frontier.pop();
+        if (!visit(heap[index])) {
+            return;
+        }
+
+        size_t left = 2 * index + 1;
+        if (left < heap.size()) {
+            frontier.push(left);
+        }
+        if (left + 1 < heap.size()) {
+            frontier.push(left + 1);
+        }
+    }
+}
+
+bool DispatchQueue::contains(int interventionId) const {
+    return positions.find(interventionId) != positions.end();
+}
+
+size_t DispatchQueue::size() const {
+    return heap.size();
+}
+
+bool DispatchQueue::empty() const {
+    return heap.empty();
+}
+
+bool DispatchQueue::moreUrgent(const Job& a, const Job& b) {
+    if (a.priority != b.priority) {
+        return a.priority > b.priority;
+    }
+    if (a.createdAt != b.createdAt) {
+        return a.createdAt < b.createdAt;
+    }
+    return a.sequence < b.sequence;
+}
+
+void DispatchQueue::siftUp(size_t index) {
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!moreUrgent(heap[index], heap[parent])) {
+            break;
+        }
+        swapNodes(index, parent);
+        index = parent;
+    }
+}
+
+void DispatchQueue::siftDown(size_t index) {
+    while (true) {
+        size_t left = 2 * index + 1;
+        size_t right = left + 1;
+        size_t best = index;
+
+        if (left < heap.size() && moreUrgent(heap[left], heap[best])) {
+            best = left;
+        }
+        if (right < heap.size() && moreUrgent(heap[right], heap[best])) {
+            best = right;
+        }
+        if (best == index) {
+            break;
+        }
+        swapNodes(index, best);
+        index = best;
+    }
+}
+
+void DispatchQueue::swapNodes(size_t a, size_t b) {
+    std::swap(heap[a], heap[b]);
+    positions[heap[a].interventionId] = a;
+    positions[heap[b].interventionId] = b;
+}
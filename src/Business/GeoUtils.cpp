@@ -0,0 +1,24 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/GeoUtils.h"
+#include <cmath>
+#include <algorithm>
+
+namespace GeoUtils {
+
+double haversineKm(double lat1, double lon1, double lat2, double lon2) {
+    const double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+
+    double dLat = (lat2 - lat1) * DEG_TO_RAD;
+    double dLon = (lon2 - lon1) * DEG_TO_RAD;
+    double sinLat = std::sin(dLat / 2);
+    double sinLon = std::sin(dLon / 2);
+
+    double a = sinLat * sinLat +
+               std::cos(lat1 * DEG_TO_RAD) * std::cos(lat2 * DEG_TO_RAD) * sinLon * sinLon;
+    return 2 * EARTH_RADIUS_KM * std::asin(std::sqrt(std::min(1.0, a)));
+}
+
+} // namespace GeoUtils
@@ -0,0 +1,172 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/GeofenceEngine.h"
+#include "Business/GeoUtils.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const double PI = 3.14159265358979323846;
+    const double KM_PER_DEGREE = GeoUtils::EARTH_RADIUS_KM * PI / 180.0;
+}
+
+GeofenceEngine::GeofenceEngine(double cellDegrees)
+    : cellDegrees(cellDegrees > 0 ? cellDegrees : 0.01),
+      lonCellCount(static_cast<std::int64_t>(std::ceil(360.0 / this->cellDegrees))),
+      exitMargin(1.2) {}
+
+std::uint64_t GeofenceEngine::cellKey(std::int64_t latIndex, std::int64_t lonIndex) {
+    return (static_cast<std::uint64_t>(latIndex) << 32) | static_cast<std::uint32_t>(lonIndex);
+}
+
+std::uint64_t GeofenceEngine::cellOf(double latitude, double longitude) const {
+    std::int64_t latIndex = static_cast<std::int64_t>(std::floor((std::max(-90.0, std::min(90.0, latitude)) + 90.0) / cellDegrees));
+    std::int64_t lonIndex = static_cast<std::int64_t>(std::floor((longitude + 180.0) / cellDegrees));
+    return cellKey(latIndex, ((lonIndex % lonCellCount) + lonCellCount) % lonCellCount);
+}
+
+void GeofenceEngine::attach(int fenceId, Fence& fence) {
+    // Bounding box of the exit circle; longitudes widen towards the poles
+    double latSpan = fence.radiusKm * exitMargin / KM_PER_DEGREE;
+    double maxLat = std::min(90.0, std::fabs(fence.latitude) + latSpan);
+    double cosMaxLat = std::cos(maxLat * PI / 180.0);
+    bool allLongitudes = cosMaxLat < 1e-9 || latSpan / cosMaxLat >= 180.0;
+    double lonSpan = allLongitudes ? 180.0 : latSpan / cosMaxLat;
+
+    std::int64_t latFirst = static_cast<std::int64_t>(std::floor((std::max(-90.0, fence.latitude - latSpan) + 90.0) / cellDegrees));
+    std::int64_t latLast = static_cast<std::int64_t>(std::floor((std::min(90.0, fence.latitude + latSpan) + 90.0) / cellDegrees));
+    std::int64_t lonFirst = allLongitudes ? 0 : static_cast<std::int64_t>(std::floor((fence.longitude - lonSpan + 180.0) / cellDegrees));
+    std::int64_t lonLast = allLongitudes ? lonCellCount - 1 : static_cast<std::int64_t>(std::floor((fence.longitude + lonSpan + 180.0) / cellDegrees));
+    lonLast = std::min(lonLast, lonFirst + lonCellCount - 1);
+
+    for (std::int64_t latIndex = latFirst; latIndex <= latLast; ++latIndex) {
+        for (std::int64_t lonIndex = lonFirst; lonIndex <= lonLast; ++lonIndex) {
+            std::uint64_t key = cellKey(latIndex, ((lonIndex % lonCellCount) + lonCellCount) % lonCellCount);
+            cells[key].push_back(fenceId);
+            fence.cells.push_back(key);
+        }
+    }
+}
+
+void GeofenceEngine::detach(int fenceId, Fence& fence) {
+    for (std::uint64_t key : fence.cells) {
+        auto cellIt = cells.find(key);
+        if (cellIt == cells.end()) {
+            continue;
+        }
+
+        auto& members = cellIt->second;
+        members.erase(std::remove(members.begin(), members.end(), fenceId), members.end());
+        if (members.empty()) {
+            cells.erase(cellIt);
+        }
+    }
+    fence.cells.clear();
+}
+
+bool GeofenceEngine::setFence(int fenceId, double latitude, double longitude, double radiusKm) {
+    if (radiusKm <= 0 || radiusKm > MAX_RADIUS_KM) {
+        return false;
+    }
+
+    Fence& fence = fences[fenceId];
+    detach(fenceId, fence);
+    fence.latitude = latitude;
+    fence.longitude = longitude;
+    fence.radiusKm = radiusKm;
+    attach(fenceId, fence);
+    return true;
+}
+
+bool GeofenceEngine::removeFence(int fenceId) {
+    auto it = fences.find(fenceId);
+    if (it == fences.end()) {
+        return false;
+    }
+
+    detach(fenceId, it->second);
+    fences.erase(it);
+
+    // Subjects inside it are dropped lazily by their next update
+    return true;
+}
+
+double GeofenceEngine::getFenceRadius(int fenceId) const {
+    auto it = fences.find(fenceId);
+    return it != fences.end() ? it->second.radiusKm : -1;
+}
+
+void GeofenceEngine::setExitMargin(double margin) {
+    margin = std::max(1.0, margin);
+    if (margin == exitMargin) {
+        return;
+    }
+
+    // The cells covered depend on the exit radius
+    exitMargin = margin;
+    for (auto& pair : fences) {
+        detach(pair.first, pair.second);
+        attach(pair.first, pair.second);
+    }
+}
+
+std::vector<GeofenceEngine::Transition> GeofenceEngine::update(const std::string& subject,
+                                                               double latitude, double longitude) {
+    std::vector<Transition> transitions;
+    std::vector<int>& current = inside[subject];
+
+    // Fences the subject was inside: leave once past the exit radius
+    for (size_t i = 0; i < current.size();) {
+        auto fenceIt = fences.find(current[i]);
+        if (fenceIt == fences.end()) {
+            current[i] = current.back();
+            current.pop_back();
+            continue;
+        }
+
+        const Fence& fence = fenceIt->second;
+        if (GeoUtils::haversineKm(latitude, longitude, fence.latitude, fence.longitude) > fence.radiusKm * exitMargin) {
+            transitions.push_back({current[i], false});
+            current[i] = current.back();
+            current.pop_back();
+            continue;
+        }
+        ++i;
+    }
+
+    // Fences around the new position: enter once within the radius
+    auto cellIt = cells.find(cellOf(latitude, longitude));
+    if (cellIt != cells.end()) {
+        for (int fenceId : cellIt->second) {
+            if (std::find(current.begin(), current.end(), fenceId) != current.end()) {
+                continue;
+            }
+
+            const Fence& fence = fences.at(fenceId);
+            if (GeoUtils::haversineKm(latitude, longitude, fence.latitude, fence.longitude) <= fence.radiusKm) {
+                transitions.push_back({fenceId, true});
+                current.push_back(fenceId);
+            }
+        }
+    }
+
+    if (current.empty()) {
+        inside.erase(subject);
+    }
+
+    return transitions;
+}
+
+bool GeofenceEngine::isInside(const std::string& subject, int fenceId) const {
+    auto it = inside.find(subject);
+    if (it == inside.end() || fences.find(fenceId) == fences.end()) {
+        return false;
+    }
+    return std::find(it->second.begin(), it->second.end(), fenceId) != it->second.end();
+}
+
+size_t GeofenceEngine::getFenceCount() const {
+    return fences.size();
+}
@@ -25,6 +25,50 @@ bool InterventionPlanner::scheduleIntervention(int interventionId, std::time_t d
     return true;
 }
 
+size_t InterventionPlanner::scheduleInterventions(std::vector<Booking>& bookings, int* nextId) {
+    for (auto& booking : bookings) {
+        booking.scheduled = false;
+    }
+
+    if (!std::is_sorted(bookings.begin(), bookings.end(),
+                        [](const Booking& a, const Booking& b) { return a.date < b.date; })) {
+        return 0;
+    }
+
+    size_t scheduled = 0;
+    std::vector<int>* day = nullptr;
+    std::time_t dayStart = 0;
+
+    for (auto& booking : bookings) {
+        // Sorted input: within 23 hours of midnight (the shortest DST day)
+        // a booking is still on the current day, without normalizing its date
+        std::time_t bookingDay = dayStart;
+        if (!day || booking.date - dayStart >= 23 * 3600) {
+            bookingDay = normalizeToDay(booking.date);
+        }
+
+        if (!day || bookingDay != dayStart) {
+            dayStart = bookingDay;
+            auto it = dailyInterventions.lower_bound(dayStart);
+            if (it == dailyInterventions.end() || it->first != dayStart) {
+                it = dailyInterventions.emplace_hint(it, dayStart, std::vector<int>());
+            }
+            day = &it->second;
+        }
+
+        if (day->size() < MAX_INTERVENTIONS_PER_DAY) {
+            if (nextId) {
+                booking.interventionId = (*nextId)++;
+            }
+            day->push_back(booking.interventionId);
+            booking.scheduled = true;
+            ++scheduled;
+        }
+    }
+
+    return scheduled;
+}
+
 bool InterventionPlanner::rescheduleIntervention(int interventionId, std::time_t oldDate,
                                               std::time_t newDate, int duration) {
     // Check if the new time slot is available
@@ -91,17 +135,22 @@ std::map<int, int> InterventionPlanner::countInterventionsPerDay(int month, int
         counts[day] = 0;
     }
 
-    // For each day in our daily interventions map
-    for (const auto& entry : dailyInterventions) {
-        // Get the day's date components
-        std::time_t dayTime = entry.first;
-        struct tm* timeinfo = std::localtime(&dayTime);
-
-        // Check if it's in the requested month and year
-        if (timeinfo->tm_mon + 1 == month && timeinfo->tm_year + 1900 == year) {
-            // Add the count of interventions for this day
-            counts[timeinfo->tm_mday] = entry.second.size();
-        }
+    // Only visit the days of the month: the map is ordered by day
+    std::tm bound = {};
+    bound.tm_year = year - 1900;
+    bound.tm_mon = month - 1;
+    bound.tm_mday = 1;
+    bound.tm_isdst = -1;
+    std::time_t monthStart = std::mktime(&bound);
+    bound.tm_mon += 1;
+    bound.tm_isdst = -1;
+    std::time_t monthEnd = std::mktime(&bound);
+
+    for (auto it = dailyInterventions.lower_bound(monthStart);
+         it != dailyInterventions.end() && it->first < monthEnd; ++it) {
+        // Add the count of interventions for this day
+        std::time_t dayTime = it->first;
+        counts[std::localtime(&dayTime)->tm_mday] = it->second.size();
     }
 
     return counts;
@@ -120,8 +169,6 @@ bool InterventionPlanner::isTimeSlotAvailable(std::time_t date, int duration) co
     }
 
     // Check if the day has fewer than the maximum allowed interventions
-    // (arbitrary limit for demonstration)
-    const int MAX_INTERVENTIONS_PER_DAY = 10;
     return it->second.size() < MAX_INTERVENTIONS_PER_DAY;
 }
 
@@ -0,0 +1,58 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/NotificationStubServer.h"
+#include <thread>
+#include <algorithm>
+
+NotificationStubServer::NotificationStubServer(std::chrono::microseconds sessionLatency,
+                                               std::chrono::microseconds messageLatency,
+                                               bool keepMessages)
+    : sessionLatency(sessionLatency), messageLatency(messageLatency), keepMessages(keepMessages) {
+}
+
+size_t NotificationStubServer::deliverBatch(const std::string& protocol,
+                                            const std::vector<std::pair<std::string, std::string>>& batch) {
+    (void)protocol; // Both protocols share the same cost model
+
+    if (batch.empty()) {
+        return 0;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Simulate the round-trips: one handshake per session, then a small cost per message
+    std::this_thread::sleep_for(sessionLatency + messageLatency * static_cast<long>(batch.size()));
+
+    double elapsedMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.sessions++;
+    stats.messages += batch.size();
+    stats.totalLatencyMs += elapsedMs;
+    stats.maxLatencyMs = std::max(stats.maxLatencyMs, elapsedMs);
+
+    if (keepMessages) {
+        received.insert(received.end(), batch.begin(), batch.end());
+    }
+
+    return batch.size();
+}
+
+NotificationStubServer::Stats NotificationStubServer::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+std::vector<std::pair<std::string, std::string>> NotificationStubServer::getReceivedMessages() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return received;
+}
+
+void NotificationStubServer::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    stats = Stats();
+    received.clear();
+}
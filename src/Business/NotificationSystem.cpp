@@ -5,86 +5,270 @@
 #include "Business/NotificationSystem.h"
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <ctime>
+#include <iterator>
+#include <algorithm>
 
 NotificationSystem::NotificationSystem(bool enableConsole, bool enableLog, const std::string& logFile)
-    : consoleEnabled(enableConsole), logEnabled(enableLog), logFile(logFile) {
+    : consoleEnabled(enableConsole), logEnabled(enableLog), logFile(logFile),
+      batchWindow(10), maxBatchSize(256), coalescingWindow(5000), stopping(false),
+      rateLimitEnabled(true), burstSize(5), refillPerSecond(10 / 60.0), digestWindow(60),
+      digestTimers(std::time(nullptr)) {
+
+    // Start one worker per channel
+    for (size_t i = 0; i < CHANNEL_COUNT; ++i) {
+        Channel channel = static_cast<Channel>(i);
+        queues[i].worker = std::thread(&NotificationSystem::runChannelWorker, this, channel);
+    }
+}
+
+NotificationSystem::~NotificationSystem() {
+    // Don't lose the notifications held back for digests
+    {
+        std::lock_guard<std::mutex> lock(limiterMutex);
+        for (size_t user = 0; user < recipientBudgets.size(); ++user) {
+            digestTimers.cancel(recipientBudgets[user].digestTimer);
+            deliverDigest(static_cast<UserHandle>(user));
+        }
+    }
+
+    // Workers drain their queue before exiting
+    stopping = true;
+    for (auto& queue : queues) {
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+        }
+        queue.wakeUp.notify_all();
+    }
+
+    for (auto& queue : queues) {
+        if (queue.worker.joinable()) {
+            queue.worker.join();
+        }
+    }
 }
 
 void NotificationSystem::setUserPreferences(const std::string& userId,
                                          const std::vector<Channel>& channels) {
-    userPreferences[userId] = channels;
+    std::uint8_t mask = 0;
+    for (const auto& channel : channels) {
+        mask |= channelBit(channel);
+    }
+    setUserPreferences(getUserHandle(userId), mask);
+}
+
+void NotificationSystem::setUserPreferences(UserHandle user, std::uint8_t channelMask) {
+    std::unique_lock<std::shared_mutex> lock(directoryMutex);
+    if (user < channelMasks.size()) {
+        channelMasks[user] = channelMask;
+    }
+}
+
+NotificationSystem::UserHandle NotificationSystem::getUserHandle(const std::string& userId) {
+    UserHandle user = findUserHandle(userId);
+    if (user != INVALID_USER) {
+        return user;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(directoryMutex);
+
+    // Another thread may have registered the user in the meantime
+    auto it = userHandles.find(userId);
+    if (it != userHandles.end()) {
+        return it->second;
+    }
+
+    user = static_cast<UserHandle>(userIds.size());
+    userHandles.emplace(userId, user);
+    userIds.push_back(userId);
+    channelMasks.push_back(0);
+    return user;
+}
+
+NotificationSystem::UserHandle NotificationSystem::findUserHandle(const std::string& userId) const {
+    std::shared_lock<std::shared_mutex> lock(directoryMutex);
+    auto it = userHandles.find(userId);
+    return it != userHandles.end() ? it->second : INVALID_USER;
+}
+
+std::uint8_t NotificationSystem::channelBit(Channel channel) {
+    return static_cast<std::uint8_t>(1u << static_cast<unsigned>(channel));
 }
 
 bool NotificationSystem::notifyUser(const std::string& userId, const std::string& message) {
+    UserHandle user = findUserHandle(userId);
+    if (user == INVALID_USER) {
+        // Default to console notification if no preferences
+        if (consoleEnabled) {
+            return enqueue(Channel::CONSOLE, userId, "[User: " + userId + "] " + message);
+        }
+        return false;
+    }
+
+    return notifyUser(user, message);
+}
+
+bool NotificationSystem::notifyUser(UserHandle user, const std::string& message) {
+    const std::string* userIdPtr;
+    std::uint8_t mask;
+    {
+        std::shared_lock<std::shared_mutex> lock(directoryMutex);
+        if (user >= userIds.size()) {
+            return false;
+        }
+        userIdPtr = &userIds[user];
+        mask = channelMasks[user];
+    }
+    const std::string& userId = *userIdPtr;
+
     // Check if user has preferences
-    auto it = userPreferences.find(userId);
-    if (it == userPreferences.end()) {
+    if (mask == 0) {
         // Default to console notification if no preferences
         if (consoleEnabled) {
-            sendToConsole("[User: " + userId + "] " + message);
-            return true;
+            return enqueue(Channel::CONSOLE, userId, "[User: " + userId + "] " + message);
         }
         return false;
     }
 
-    // Send to each preferred channel
-    const auto& channels = it->second;
+    // Queue on each preferred channel
     bool notified = false;
 
-    for (const auto& channel : channels) {
-        switch (channel) {
-            case Channel::CONSOLE:
-                if (consoleEnabled) {
-                    sendToConsole("[User: " + userId + "] " + message);
-                    notified = true;
-                }
-                break;
-            case Channel::LOG:
-                if (logEnabled) {
-                    sendToLog("[User: " + userId + "] " + message);
-                    notified = true;
-                }
-                break;
-            case Channel::EMAIL:
-                sendToEmail(userId + "@company.com", message);
-                notified = true;
-                break;
-            case Channel::MOBILE:
-                sendToMobile(userId, message);
-                notified = true;
-                break;
-        }
+    if ((mask & channelBit(Channel::CONSOLE)) && consoleEnabled) {
+        notified |= enqueue(Channel::CONSOLE, userId, "[User: " + userId + "] " + message);
+    }
+    if ((mask & channelBit(Channel::LOG)) && logEnabled) {
+        notified |= enqueue(Channel::LOG, userId, "[User: " + userId + "] " + message);
+    }
+    if (mask & channelBit(Channel::EMAIL)) {
+        notified |= enqueue(Channel::EMAIL, userId + "@company.com", message);
+    }
+    if (mask & channelBit(Channel::MOBILE)) {
+        notified |= enqueue(Channel::MOBILE, userId, message);
     }
 
     return notified;
 }
 
 bool NotificationSystem::notifyTechnician(const std::string& technicianId, const std::string& message) {
-    // Similar to notifyUser, but specific for technicians
-    // For simplicity, we'll use the same mechanism
-    return notifyUser(technicianId, message);
+    // Similar to notifyUser, but rate limited so a storm of events
+    // doesn't flood the technician
+    return notifyLimited(getUserHandle(technicianId), message);
 }
 
 int NotificationSystem::broadcastNotification(const std::string& message) {
     int notifiedCount = 0;
 
-    // Notify all users with preferences
-    for (const auto& userPref : userPreferences) {
-        if (notifyUser(userPref.first, message)) {
+    // Collect all users with preferences, then notify them without holding the directory
+    std::vector<UserHandle> recipients;
+    {
+        std::shared_lock<std::shared_mutex> lock(directoryMutex);
+        for (size_t user = 0; user < channelMasks.size(); ++user) {
+            if (channelMasks[user] != 0) {
+                recipients.push_back(static_cast<UserHandle>(user));
+            }
+        }
+    }
+
+    for (UserHandle user : recipients) {
+        if (notifyLimited(user, message)) {
             notifiedCount++;
         }
     }
 
     // If no specific users, but console is enabled, send there
     if (notifiedCount == 0 && consoleEnabled) {
-        sendToConsole("[BROADCAST] " + message);
+        enqueue(Channel::CONSOLE, "BROADCAST", "[BROADCAST] " + message);
         notifiedCount = 1;
     }
 
     return notifiedCount;
 }
 
+bool NotificationSystem::addToGroup(const std::string& group, const std::string& userId) {
+    UserHandle user = getUserHandle(userId);
+
+    std::unique_lock<std::shared_mutex> lock(directoryMutex);
+    auto& members = recipientGroups[group];
+    if (std::find(members.begin(), members.end(), user) != members.end()) {
+        return false;
+    }
+
+    members.push_back(user);
+    return true;
+}
+
+bool NotificationSystem::removeFromGroup(const std::string& group, const std::string& userId) {
+    UserHandle user = findUserHandle(userId);
+    if (user == INVALID_USER) {
+        return false;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(directoryMutex);
+    auto groupIt = recipientGroups.find(group);
+    if (groupIt == recipientGroups.end()) {
+        return false;
+    }
+
+    auto& members = groupIt->second;
+    auto it = std::find(members.begin(), members.end(), user);
+    if (it == members.end()) {
+        return false;
+    }
+
+    members.erase(it);
+    return true;
+}
+
+void NotificationSystem::defineGroup(const std::string& group, const std::vector<std::string>& userIds) {
+    std::vector<UserHandle> members;
+    members.reserve(userIds.size());
+    for (const auto& userId : userIds) {
+        UserHandle user = getUserHandle(userId);
+        if (std::find(members.begin(), members.end(), user) == members.end()) {
+            members.push_back(user);
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(directoryMutex);
+    recipientGroups[group] = std::move(members);
+}
+
+std::vector<std::string> NotificationSystem::getGroupMembers(const std::string& group) const {
+    std::vector<std::string> result;
+
+    std::shared_lock<std::shared_mutex> lock(directoryMutex);
+    auto it = recipientGroups.find(group);
+    if (it != recipientGroups.end()) {
+        result.reserve(it->second.size());
+        for (UserHandle user : it->second) {
+            result.push_back(userIds[user]);
+        }
+    }
+    return result;
+}
+
+int NotificationSystem::notifyGroup(const std::string& group, const std::string& message) {
+    // Copy the cached membership so delivery doesn't hold the directory lock
+    std::vector<UserHandle> members;
+    {
+        std::shared_lock<std::shared_mutex> lock(directoryMutex);
+        auto it = recipientGroups.find(group);
+        if (it == recipientGroups.end()) {
+            return 0;
+        }
+        members = it->second;
+    }
+
+    int notifiedCount = 0;
+    for (UserHandle user : members) {
+        if (notifyLimited(user, message)) {
+            notifiedCount++;
+        }
+    }
+    return notifiedCount;
+}
+
 void NotificationSystem::setConsoleEnabled(bool enabled) {
     consoleEnabled = enabled;
 }
@@ -92,16 +276,267 @@ void NotificationSystem::setConsoleEnabled(bool enabled) {
 void NotificationSystem::setLogEnabled(bool enabled, const std::string& newLogFile) {
     logEnabled = enabled;
     if (!newLogFile.empty()) {
+        std::lock_guard<std::mutex> lock(configMutex);
         logFile = newLogFile;
     }
 }
 
-void NotificationSystem::sendToConsole(const std::string& message) {
-    std::cout << "NOTIFICATION: " << message << std::endl;
+void NotificationSystem::setStubServer(std::shared_ptr<NotificationStubServer> server) {
+    std::lock_guard<std::mutex> lock(configMutex);
+    stubServer = server;
+}
+
+void NotificationSystem::setBatching(std::chrono::milliseconds window, size_t maxSize) {
+    std::lock_guard<std::mutex> lock(configMutex);
+    batchWindow = window;
+    maxBatchSize = maxSize > 0 ? maxSize : 1;
+}
+
+void NotificationSystem::setCoalescingWindow(std::chrono::milliseconds window) {
+    std::lock_guard<std::mutex> lock(configMutex);
+    coalescingWindow = window;
+}
+
+void NotificationSystem::setRateLimit(bool enabled, int burstSize, int perMinute, int digestWindowSeconds) {
+    std::lock_guard<std::mutex> lock(limiterMutex);
+    rateLimitEnabled = enabled;
+    this->burstSize = burstSize > 0 ? burstSize : 1;
+    refillPerSecond = perMinute > 0 ? perMinute / 60.0 : 0.0;
+    digestWindow = digestWindowSeconds > 0 ? digestWindowSeconds : 1;
+}
+
+size_t NotificationSystem::processDigests(std::time_t now) {
+    std::lock_guard<std::mutex> lock(limiterMutex);
+    return digestTimers.advance(now);
+}
+
+size_t NotificationSystem::getPendingDigestCount() {
+    std::lock_guard<std::mutex> lock(limiterMutex);
+
+    size_t count = 0;
+    for (const auto& budget : recipientBudgets) {
+        count += budget.digest.size();
+    }
+    return count;
+}
+
+bool NotificationSystem::notifyLimited(UserHandle user, const std::string& message) {
+    if (user == INVALID_USER) {
+        return false;
+    }
+
+    std::time_t now = std::time(nullptr);
+    {
+        std::lock_guard<std::mutex> lock(limiterMutex);
+        if (rateLimitEnabled) {
+            // Close the digest windows that are over
+            digestTimers.advance(now);
+
+            // Refill the recipient's token bucket
+            if (user >= recipientBudgets.size()) {
+                recipientBudgets.resize(user + 1);
+            }
+            RecipientBudget& budget = recipientBudgets[user];
+            if (budget.lastRefill == 0) {
+                budget.tokens = burstSize;
+            } else {
+                budget.tokens = std::min<double>(burstSize,
+                    budget.tokens + static_cast<double>(now - budget.lastRefill) * refillPerSecond);
+            }
+            budget.lastRefill = now;
+
+            if (budget.tokens < 1.0) {
+                // Over budget: hold the message back for the recipient's digest
+                budget.digest.push_back(message);
+                if (budget.digestTimer == TimerWheel::INVALID_TIMER) {
+                    budget.digestTimer = digestTimers.schedule(now + digestWindow,
+                        [this, user]() { deliverDigest(user); });
+                }
+                return true;
+            }
+
+            budget.tokens -= 1.0;
+        }
+    }
+
+    return notifyUser(user, message);
+}
+
+void NotificationSystem::deliverDigest(UserHandle user) {
+    if (user >= recipientBudgets.size()) {
+        return;
+    }
+
+    RecipientBudget& budget = recipientBudgets[user];
+    budget.digestTimer = TimerWheel::INVALID_TIMER;
+    if (budget.digest.empty()) {
+        return;
+    }
+
+    // Summarize the held-back notifications, listing only the most recent ones
+    const size_t MAX_DIGEST_LINES = 10;
+    std::ostringstream summary;
+    summary << "Digest: " << budget.digest.size() << " notification(s) held back";
+
+    size_t first = budget.digest.size() > MAX_DIGEST_LINES ? budget.digest.size() - MAX_DIGEST_LINES : 0;
+    if (first > 0) {
+        summary << " (" << first << " older not shown)";
+    }
+    for (size_t i = first; i < budget.digest.size(); ++i) {
+        summary << std::endl << "- " << budget.digest[i];
+    }
+
+    budget.digest.clear();
+    notifyUser(user, summary.str());
+}
+
+void NotificationSystem::flush() {
+    for (auto& queue : queues) {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        queue.wakeUp.notify_all();
+        queue.drained.wait(lock, [&queue]() { return queue.pending.empty() && !queue.busy; });
+    }
+}
+
+NotificationSystem::ChannelStats NotificationSystem::getChannelStats(Channel channel) const {
+    const ChannelQueue& queue = queues[static_cast<size_t>(channel)];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    return queue.stats;
+}
+
+bool NotificationSystem::enqueue(Channel channel, const std::string& recipient, const std::string& message) {
+    std::chrono::milliseconds window;
+    size_t batchSize;
+    {
+        std::lock_guard<std::mutex> lock(configMutex);
+        window = coalescingWindow;
+        batchSize = maxBatchSize;
+    }
+
+    ChannelQueue& queue = queues[static_cast<size_t>(channel)];
+
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    auto now = std::chrono::steady_clock::now(); // Under the lock: recentOrder stays sorted
+
+    // Drop the expired entries, oldest first: each key has exactly one entry in recentOrder
+    while (!queue.recentOrder.empty() && now - queue.recentOrder.front().first >= window) {
+        queue.recentMessages.erase(queue.recentOrder.front().second);
+        queue.recentOrder.pop_front();
+    }
+
+    // Coalesce identical messages sent to the same recipient within the window
+    if (window.count() > 0) {
+        std::string key = recipient + '\x1f' + message;
+        if (queue.recentMessages.count(key) > 0) {
+            queue.stats.coalesced++;
+            return true;
+        }
+
+        queue.recentMessages.insert(key);
+        queue.recentOrder.emplace_back(now, std::move(key));
+    }
+
+    queue.pending.push_back(PendingNotification{recipient, message});
+    queue.stats.enqueued++;
+
+    // Wake the worker on the first item, and again once a batch is full
+    bool wake = queue.pending.size() == 1 || queue.pending.size() >= batchSize;
+    lock.unlock();
+
+    if (wake) {
+        queue.wakeUp.notify_one();
+    }
+    return true;
+}
+
+void NotificationSystem::runChannelWorker(Channel channel) {
+    ChannelQueue& queue = queues[static_cast<size_t>(channel)];
+    std::vector<PendingNotification> batch;
+
+    while (true) {
+        std::chrono::milliseconds window;
+        size_t batchSize;
+        {
+            std::lock_guard<std::mutex> lock(configMutex);
+            window = batchWindow;
+            batchSize = maxBatchSize;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.wakeUp.wait(lock, [&]() { return stopping || !queue.pending.empty(); });
+
+            if (queue.pending.empty()) {
+                break; // Stopping and nothing left to deliver
+            }
+
+            // Give the batch a chance to fill up before sending it
+            if (!stopping && queue.pending.size() < batchSize) {
+                queue.wakeUp.wait_for(lock, window, [&]() {
+                    return stopping || queue.pending.size() >= batchSize;
+                });
+            }
+
+            size_t count = std::min(queue.pending.size(), batchSize);
+            batch.assign(std::make_move_iterator(queue.pending.begin()),
+                         std::make_move_iterator(queue.pending.begin() + count));
+            queue.pending.erase(queue.pending.begin(), queue.pending.begin() + count);
+            queue.busy = true;
+        }
+
+        deliverBatch(channel, batch);
+
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.busy = false;
+            queue.stats.delivered += batch.size();
+            queue.stats.batches++;
+            if (queue.pending.empty()) {
+                queue.drained.notify_all();
+            }
+        }
+        batch.clear();
+    }
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.drained.notify_all();
 }
 
-void NotificationSystem::sendToLog(const std::string& message) {
-    std::ofstream log(logFile, std::ios::app);
+void NotificationSystem::deliverBatch(Channel channel, const std::vector<PendingNotification>& batch) {
+    switch (channel) {
+        case Channel::CONSOLE:
+            sendToConsole(batch);
+            break;
+        case Channel::LOG:
+            sendToLog(batch);
+            break;
+        case Channel::EMAIL:
+            sendToEmail(batch);
+            break;
+        case Channel::MOBILE:
+            sendToMobile(batch);
+            break;
+    }
+}
+
+void NotificationSystem::sendToConsole(const std::vector<PendingNotification>& batch) {
+    // Build the whole batch first so it is written in one go
+    std::ostringstream out;
+    for (const auto& notification : batch) {
+        out << "NOTIFICATION: " << notification.message << '\n';
+    }
+    std::cout << out.str() << std::flush;
+}
+
+void NotificationSystem::sendToLog(const std::vector<PendingNotification>& batch) {
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(configMutex);
+        path = logFile;
+    }
+
+    // One open/append/close for the whole batch
+    std::ofstream log(path, std::ios::app);
     if (log.is_open()) {
         // Get current time
         std::time_t now = std::time(nullptr);
@@ -109,21 +544,61 @@ void NotificationSystem::sendToLog(const std::string& message) {
         char timestamp[20];
         std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", timeinfo);
 
-        log << "[" << timestamp << "] " << message << std::endl;
+        for (const auto& notification : batch) {
+            log << "[" << timestamp << "] " << notification.message << '\n';
+        }
         log.close();
     }
 }
 
-void NotificationSystem::sendToEmail(const std::string& recipient, const std::string& message) {
-    // This is a simulation - in a real app, it would connect to an email service
-    std::cout << "Simulating email to " << recipient << ": " << message << std::endl;
+void NotificationSystem::sendToEmail(const std::vector<PendingNotification>& batch) {
+    std::shared_ptr<NotificationStubServer> server;
+    {
+        std::lock_guard<std::mutex> lock(configMutex);
+        server = stubServer;
+    }
+
+    if (server) {
+        // One SMTP session for the whole batch
+        std::vector<std::pair<std::string, std::string>> messages;
+        messages.reserve(batch.size());
+        for (const auto& notification : batch) {
+            messages.emplace_back(notification.recipient, notification.message);
+        }
+        server->deliverBatch("SMTP", messages);
+        return;
+    }
 
-    // For a real implementation, you might want to use a library like libcurl or a mail API
+    // This is a simulation - in a real app, it would connect to an email service
+    std::ostringstream out;
+    for (const auto& notification : batch) {
+        out << "Simulating email to " << notification.recipient << ": " << notification.message << '\n';
+    }
+    std::cout << out.str() << std::flush;
 }
 
-void NotificationSystem::sendToMobile(const std::string& recipient, const std::string& message) {
-    // This is a simulation - in a real app, it would connect to a push notification service
-    std::cout << "Simulating mobile push to " << recipient << ": " << message << std::endl;
+void NotificationSystem::sendToMobile(const std::vector<PendingNotification>& batch) {
+    std::shared_ptr<NotificationStubServer> server;
+    {
+        std::lock_guard<std::mutex> lock(configMutex);
+        server = stubServer;
+    }
 
-    // For a real implementation, you might want to use Firebase Cloud Messaging or similar
-}
\ No newline at end of file
+    if (server) {
+        // One push request for the whole batch
+        std::vector<std::pair<std::string, std::string>> messages;
+        messages.reserve(batch.size());
+        for (const auto& notification : batch) {
+            messages.emplace_back(notification.recipient, notification.message);
+        }
+        server->deliverBatch("PUSH", messages);
+        return;
+    }
+
+    // This is a simulation - in a real app, it would connect to a push notification service
+    std::ostringstream out;
+    for (const auto& notification : batch) {
+        out << "Simulating mobile push to " << notification.recipient << ": " << notification.message << '\n';
+    }
+    std::cout << out.str() << std::flush;
+}
@@ -0,0 +1,107 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/RecurrenceCache.h"
+
+RecurrenceCache::RecurrenceCache(size_t capacity)
+    : capacity(capacity == 0 ? 1 : capacity) {
+}
+
+RecurrenceCache::Window& RecurrenceCache::lookup(const RecurrenceEngine& engine, std::time_t from, std::time_t to) {
+    auto found = index.find(std::make_pair(from, to));
+    if (found != index.end()) {
+        // Most recently used goes first
+        windows.splice(windows.begin(), windows, found->second);
+        Window& window = windows.front();
+
+        if (window.generation != engine.getGeneration()) {
+            window.generation = engine.getGeneration();
+            window.occurrences = engine.expand(from, to);
+            window.instances.clear();
+            window.instanceViews.clear();
+            window.instantiated = false;
+            window.dayCounts.clear();
+            window.counted = false;
+        }
+        return window;
+    }
+
+    if (windows.size() >= capacity) {
+        index.erase(std::make_pair(windows.back().from, windows.back().to));
+        windows.pop_back();
+    }
+
+    windows.push_front(Window{from, to, engine.getGeneration(), engine.expand(from, to), {}, {}, false, {}, false});
+    index[std::make_pair(from, to)] = windows.begin();
+    return windows.front();
+}
+
+const std::vector<RecurrenceEngine::Occurrence>& RecurrenceCache::getOccurrences(const RecurrenceEngine& engine,
+                                                                                 std::time_t from, std::time_t to) {
+    return lookup(engine, from, to).occurrences;
+}
+
+std::vector<const Intervention*> RecurrenceCache::getInstances(const RecurrenceEngine& engine,
+                                                               std::time_t from, std::time_t to) {
+    Window& window = lookup(engine, from, to);
+
+    if (!window.instantiated) {
+        window.instances.reserve(window.occurrences.size());
+        window.instanceViews.reserve(window.occurrences.size());
+        for (const auto& occurrence : window.occurrences) {
+            std::unique_ptr<Intervention> intervention = engine.instantiate(occurrence);
+            if (!intervention) {
+                continue;
+            }
+            intervention->setId(-1); // Not created yet
+            window.instanceViews.push_back(intervention.get());
+            window.instances.push_back(std::move(intervention));
+        }
+        window.instantiated = true;
+    }
+
+    return window.instanceViews;
+}
+
+const std::map<int, int>& RecurrenceCache::getDayCounts(const RecurrenceEngine& engine,
+                                                        std::time_t from, std::time_t to) {
+    Window& window = lookup(engine, from, to);
+
+    if (!window.counted) {
+        // Occurrences are sorted: convert a date only when it passes the end
+        // of the day of the previous one
+        std::time_t nextDayStart = 0;
+        int day = 0;
+        for (const auto& occurrence : window.occurrences) {
+            if (day == 0 || occurrence.date >= nextDayStart) {
+                std::tm local{};
+#ifdef WINDOWS_PLATFORM
+                localtime_s(&local, &occurrence.date);
+#else
+                localtime_r(&occurrence.date, &local); // The scheduler thread may convert dates too
+#endif
+                day = local.tm_mday;
+                local.tm_mday += 1;
+                local.tm_hour = 0;
+                local.tm_min = 0;
+                local.tm_sec = 0;
+                local.tm_isdst = -1;
+                nextDayStart = std::mktime(&local);
+            }
+            ++window.dayCounts[day];
+        }
+        window.counted = true;
+    }
+
+    return window.dayCounts;
+}
+
+void RecurrenceCache::clear() {
+    windows.clear();
+    index.clear();
+}
+
+size_t RecurrenceCache::size() const {
+    return windows.size();
+}
@@ -0,0 +1,378 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/RecurrenceEngine.h"
+#include <algorithm>
+#include <sstream>
+#include <cstdio>
+
+namespace {
+    int daysInMonth(int month, int year) {
+        static const int daysPerMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        if (month == 1 && (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0))) {
+            return 29;
+        }
+        return daysPerMonth[month];
+    }
+}
+
+bool RecurrenceRule::parse(const std::string& text, RecurrenceRule& rule) {
+    RecurrenceRule parsed;
+    bool hasFrequency = false;
+
+    std::istringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, ';')) {
+        if (part.empty()) {
+            continue;
+        }
+
+        size_t equals = part.find('=');
+        if (equals == std::string::npos) {
+            return false;
+        }
+        std::string key = part.substr(0, equals);
+        std::string value = part.substr(equals + 1);
+
+        if (key == "FREQ") {
+            if (value == "DAILY") {
+                parsed.frequency = Frequency::DAILY;
+            } else if (value == "WEEKLY") {
+                parsed.frequency = Frequency::WEEKLY;
+            } else if (value == "MONTHLY") {
+                parsed.frequency = Frequency::MONTHLY;
+            } else {
+                return false;
+            }
+            hasFrequency = true;
+        } else if (key == "INTERVAL" || key == "COUNT") {
+            int number = 0;
+            char extra;
+            if (std::sscanf(value.c_str(), "%d%c", &number, &extra) != 1 || number <= 0) {
+                return false;
+            }
+            (key == "INTERVAL" ? parsed.interval : parsed.count) = number;
+        } else if (key == "UNTIL") {
+            std::tm until = {};
+            if (std::sscanf(value.c_str(), "%d-%d-%d", &until.tm_year, &until.tm_mon, &until.tm_mday) != 3) {
+                return false;
+            }
+            until.tm_year -= 1900;
+            until.tm_mon -= 1;
+            until.tm_hour = 23;
+            until.tm_min = 59;
+            until.tm_sec = 59;
+            until.tm_isdst = -1;
+            parsed.until = std::mktime(&until);
+            if (parsed.until == -1) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+
+    if (!hasFrequency) {
+        return false;
+    }
+
+    rule = parsed;
+    return true;
+}
+
+std::string RecurrenceRule::toString() const {
+    static const char* const FREQUENCIES[] = {"DAILY", "WEEKLY", "MONTHLY"};
+
+    std::string text = std::string("FREQ=") + FREQUENCIES[static_cast<int>(frequency)];
+    if (interval != 1) {
+        text += ";INTERVAL=" + std::to_string(interval);
+    }
+    if (count > 0) {
+        text += ";COUNT=" + std::to_string(count);
+    }
+    if (until != 0) {
+        char buffer[16];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", std::localtime(&until));
+        text += std::string(";UNTIL=") + buffer;
+    }
+    return text;
+}
+
+RecurrenceEngine::RecurrenceEngine()
+    : nextSeriesId(1), generation(0) {
+}
+
+std::time_t RecurrenceEngine::occurrenceDate(const Series& entry, int index) {
+    const RecurrenceRule& rule = entry.rule;
+    if (index < 0 || (rule.count > 0 && index >= rule.count)) {
+        return -1;
+    }
+
+    // Step the local calendar fields so the time of day survives DST changes
+    std::tm local = entry.start;
+    long periods = static_cast<long>(index) * rule.interval;
+    switch (rule.frequency) {
+        case RecurrenceRule::Frequency::DAILY:
+            local.tm_mday += static_cast<int>(periods);
+            break;
+        case RecurrenceRule::Frequency::WEEKLY:
+            local.tm_mday += static_cast<int>(periods * 7);
+            break;
+        case RecurrenceRule::Frequency::MONTHLY: {
+            long months = local.tm_mon + periods;
+            local.tm_year += static_cast<int>(months / 12);
+            local.tm_mon = static_cast<int>(months % 12);
+            local.tm_mday = std::min(entry.start.tm_mday, daysInMonth(local.tm_mon, local.tm_year + 1900));
+            break;
+        }
+    }
+    local.tm_isdst = -1;
+
+    std::time_t date = std::mktime(&local);
+    if (rule.until != 0 && date > rule.until) {
+        return -1;
+    }
+    return date;
+}
+
+int RecurrenceEngine::firstIndexFrom(const Series& entry, std::time_t date, std::time_t& indexDate) {
+    std::time_t first = entry.prototype->getDate();
+    int index = 0;
+
+    if (date > first) {
+        // Estimate from the period, biased so it never passes the answer: an
+        // hour covers DST shifts, four days cover month lengths and the
+        // clamping to short months. A couple of date computations remain,
+        // however far the date is.
+        double period = 86400.0 * entry.rule.interval;
+        double bias = 3601.0;
+        if (entry.rule.frequency == RecurrenceRule::Frequency::WEEKLY) {
+            period *= 7;
+        } else if (entry.rule.frequency == RecurrenceRule::Frequency::MONTHLY) {
+            period *= 30.436875; // Gregorian average month
+            bias = 4 * 86400.0;
+        }
+
+        double estimate = (static_cast<double>(date - first) - bias) / period;
+        index = estimate > 0 ? static_cast<int>(std::min(estimate, 1e9)) : 0;
+    }
+
+    while ((indexDate = occurrenceDate(entry, index)) != -1 && indexDate < date) {
+        ++index;
+    }
+    return index;
+}
+
+void RecurrenceEngine::collect(int seriesId, const Series& entry, std::time_t from, std::time_t to,
+                               std::vector<Occurrence>& occurrences) {
+    int duration = entry.prototype->getDuration();
+    from = std::max(from, entry.missedBefore); // Earlier ones are no longer pending
+    if (from >= to) {
+        return;
+    }
+
+    // Occurrences at their rule date, unless an exception replaces them
+    std::time_t date;
+    for (int index = firstIndexFrom(entry, from, date); date != -1 && date < to;
+         date = occurrenceDate(entry, ++index)) {
+        if (entry.exceptions.find(index) == entry.exceptions.end()) {
+            occurrences.push_back({seriesId, index, date, duration});
+        }
+    }
+
+    // Occurrences moved into the window
+    for (auto it = entry.moved.lower_bound(from); it != entry.moved.end() && it->first < to; ++it) {
+        occurrences.push_back({seriesId, it->second, it->first, duration});
+    }
+}
+
+void RecurrenceEngine::setException(Series& entry, int index, const Exception& exception) {
+    auto it = entry.exceptions.find(index);
+    if (it != entry.exceptions.end() && it->second.kind == Exception::Kind::MOVED) {
+        auto range = entry.moved.equal_range(it->second.date);
+        for (auto moved = range.first; moved != range.second; ++moved) {
+            if (moved->second == index) {
+                entry.moved.erase(moved);
+                break;
+            }
+        }
+    }
+
+    entry.exceptions[index] = exception;
+    if (exception.kind == Exception::Kind::MOVED) {
+        entry.moved.emplace(exception.date, index);
+    }
+}
+
+RecurrenceEngine::Series* RecurrenceEngine::findOccurrence(int seriesId, int index) {
+    auto it = series.find(seriesId);
+    if (it == series.end() || occurrenceDate(it->second, index) == -1) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+int RecurrenceEngine::addSeries(std::unique_ptr<Intervention> prototype, const RecurrenceRule& rule) {
+    if (!prototype || rule.interval <= 0 || rule.count < 0) {
+        return -1;
+    }
+
+    std::time_t first = prototype->getDate();
+    const std::tm* local = std::localtime(&first);
+    if (!local) {
+        return -1;
+    }
+
+    int seriesId = nextSeriesId++;
+    Series& entry = series[seriesId];
+    entry.prototype = std::move(prototype);
+    entry.rule = rule;
+    entry.start = *local;
+    ++generation;
+    return seriesId;
+}
+
+bool RecurrenceEngine::removeSeries(int seriesId) {
+    if (series.erase(seriesId) == 0) {
+        return false;
+    }
+
+    ++generation;
+    return true;
+}
+
+size_t RecurrenceEngine::getSeriesCount() const {
+    return series.size();
+}
+
+unsigned long RecurrenceEngine::getGeneration() const {
+    return generation;
+}
+
+const Intervention* RecurrenceEngine::getPrototype(int seriesId) const {
+    auto it = series.find(seriesId);
+    return it != series.end() ? it->second.prototype.get() : nullptr;
+}
+
+const RecurrenceRule* RecurrenceEngine::getRule(int seriesId) const {
+    auto it = series.find(seriesId);
+    return it != series.end() ? &it->second.rule : nullptr;
+}
+
+bool RecurrenceEngine::cancelOccurrence(int seriesId, int index) {
+    Series* entry = findOccurrence(seriesId, index);
+    if (!entry) {
+        return false;
+    }
+
+    setException(*entry, index, {Exception::Kind::CANCELLED, 0, -1});
+    ++generation;
+    return true;
+}
+
+bool RecurrenceEngine::moveOccurrence(int seriesId, int index, std::time_t date) {
+    Series* entry = findOccurrence(seriesId, index);
+    if (!entry) {
+        return false;
+    }
+
+    setException(*entry, index, {Exception::Kind::MOVED, date, -1});
+    ++generation;
+    return true;
+}
+
+bool RecurrenceEngine::markMaterialized(int seriesId, int index, int interventionId) {
+    Series* entry = findOccurrence(seriesId, index);
+    if (!entry) {
+        return false;
+    }
+
+    setException(*entry, index, {Exception::Kind::MATERIALIZED, 0, interventionId});
+    ++generation;
+    return true;
+}
+
+int RecurrenceEngine::getMaterializedId(int seriesId, int index) const {
+    auto it = series.find(seriesId);
+    if (it == series.end()) {
+        return -1;
+    }
+
+    auto exception = it->second.exceptions.find(index);
+    if (exception == it->second.exceptions.end() || exception->second.kind != Exception::Kind::MATERIALIZED) {
+        return -1;
+    }
+    return exception->second.interventionId;
+}
+
+size_t RecurrenceEngine::expireBefore(std::time_t date) {
+    size_t missed = 0;
+    std::vector<Occurrence> occurrences;
+    for (auto& pair : series) {
+        Series& entry = pair.second;
+        if (date <= entry.missedBefore) {
+            continue;
+        }
+
+        occurrences.clear();
+        collect(pair.first, entry, entry.missedBefore, date, occurrences);
+        entry.missedCount += static_cast<int>(occurrences.size());
+        entry.missedBefore = date;
+        missed += occurrences.size();
+    }
+
+    // Moving the date alone does not change any expansion after it
+    if (missed > 0) {
+        ++generation;
+    }
+    return missed;
+}
+
+int RecurrenceEngine::getMissedCount(int seriesId) const {
+    auto it = series.find(seriesId);
+    return it != series.end() ? it->second.missedCount : -1;
+}
+
+std::vector<RecurrenceEngine::Occurrence> RecurrenceEngine::expand(std::time_t from, std::time_t to) const {
+    std::vector<Occurrence> occurrences;
+    for (const auto& pair : series) {
+        collect(pair.first, pair.second, from, to, occurrences);
+    }
+
+    std::sort(occurrences.begin(), occurrences.end(), [](const Occurrence& a, const Occurrence& b) {
+        if (a.date != b.date) {
+            return a.date < b.date;
+        }
+        return a.seriesId != b.seriesId ? a.seriesId < b.seriesId : a.index < b.index;
+    });
+    return occurrences;
+}
+
+std::vector<RecurrenceEngine::Occurrence> RecurrenceEngine::expandSeries(int seriesId, std::time_t from,
+                                                                         std::time_t to) const {
+    std::vector<Occurrence> occurrences;
+    auto it = series.find(seriesId);
+    if (it == series.end()) {
+        return occurrences;
+    }
+
+    collect(seriesId, it->second, from, to, occurrences);
+    std::sort(occurrences.begin(), occurrences.end(), [](const Occurrence& a, const Occurrence& b) {
+        return a.date != b.date ? a.date < b.date : a.index < b.index;
+    });
+    return occurrences;
+}
+
+std::unique_ptr<Intervention> RecurrenceEngine::instantiate(const Occurrence& occurrence) const {
+    auto it = series.find(occurrence.seriesId);
+    if (it == series.end()) {
+        return nullptr;
+    }
+
+    auto intervention = it->second.prototype->clone();
+    if (intervention) {
+        intervention->setDate(occurrence.date);
+    }
+    return intervention;
+}
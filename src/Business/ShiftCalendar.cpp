@@ -0,0 +1,299 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/ShiftCalendar.h"
+#include <algorithm>
+#include <bitset>
+
+namespace {
+
+// Floor division, so times before the epoch land in the right bucket
+std::int64_t floorDiv(std::int64_t value, std::int64_t divisor) {
+    std::int64_t quotient = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+
+std::int64_t bucketOf(std::time_t time) {
+    return floorDiv(static_cast<std::int64_t>(time), ShiftCalendar::BUCKET_SECONDS);
+}
+
+// One past the last bucket touched by [start, end)
+std::int64_t bucketEnd(std::time_t end) {
+    return floorDiv(static_cast<std::int64_t>(end) + ShiftCalendar::BUCKET_SECONDS - 1,
+                    ShiftCalendar::BUCKET_SECONDS);
+}
+
+// Bits [from, to) of a word, 0 <= from < to <= 64
+std::uint64_t bitRange(unsigned from, unsigned to) {
+    std::uint64_t high = to == 64 ? ~0ULL : (1ULL << to) - 1;
+    return high & ~((1ULL << from) - 1);
+}
+
+// Index of the lowest set bit, word must not be 0
+unsigned lowestBit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned index = 0;
+    while ((word & 1) == 0) {
+        word >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+} // namespace
+
+void ShiftCalendar::writeRange(std::int64_t firstBucket, std::int64_t lastBucket, bool onCallMap, bool value) {
+    std::int64_t bucket = firstBucket;
+    while (bucket < lastBucket) {
+        std::int64_t pageIndex = floorDiv(bucket, BUCKETS_PER_PAGE);
+        std::int64_t offset = bucket - pageIndex * BUCKETS_PER_PAGE;
+        std::int64_t stop = std::min(lastBucket, (pageIndex + 1) * BUCKETS_PER_PAGE);
+
+        // Clearing an untouched page is a no-op
+        auto pageIt = pages.find(pageIndex);
+        if (pageIt == pages.end()) {
+            if (!value) {
+                bucket = stop;
+                continue;
+            }
+            pageIt = pages.emplace(pageIndex, Page()).first;
+        }
+        auto& bits = onCallMap ? pageIt->second.onCall : pageIt->second.working;
+
+        while (bucket < stop) {
+            size_t word = static_cast<size_t>(offset / 64);
+            unsigned from = static_cast<unsigned>(offset % 64);
+            unsigned to = static_cast<unsigned>(std::min<std::int64_t>(64, from + (stop - bucket)));
+            std::uint64_t mask = bitRange(from, to);
+
+            bits[word] = value ? (bits[word] | mask) : (bits[word] & ~mask);
+            bucket += to - from;
+            offset += to - from;
+        }
+    }
+}
+
+void ShiftCalendar::addRange(std::time_t start, std::time_t end, bool onCallMap) {
+    if (end <= start) {
+        return;
+    }
+
+    // Round inward: a shift starting at 09:10 must not make 09:00 bookable
+    std::int64_t firstBucket = bucketEnd(start);
+    std::int64_t lastBucket = bucketOf(end);
+    if (firstBucket >= lastBucket) {
+        return;
+    }
+    writeRange(firstBucket, lastBucket, onCallMap, true);
+
+    // Holidays win over anything added later
+    for (const auto& holiday : holidays) {
+        if (holiday.first < end && holiday.second > start) {
+            writeRange(bucketOf(holiday.first), bucketEnd(holiday.second), onCallMap, false);
+        }
+    }
+}
+
+void ShiftCalendar::addShift(std::time_t start, std::time_t end) {
+    addRange(start, end, false);
+}
+
+void ShiftCalendar::addOnCall(std::time_t start, std::time_t end) {
+    addRange(start, end, true);
+}
+
+void ShiftCalendar::addHoliday(std::time_t start, std::time_t end) {
+    if (end <= start) {
+        return;
+    }
+
+    holidays.push_back({start, end});
+    writeRange(bucketOf(start), bucketEnd(end), false, false);
+    writeRange(bucketOf(start), bucketEnd(end), true, false);
+}
+
+void ShiftCalendar::addWeeklyShift(int weekday, int startMinute, int endMinute,
+                                   std::time_t from, std::time_t to, bool onCall) {
+    if (endMinute <= startMinute) {
+        return;
+    }
+
+    // Walk local days so that shifts follow daylight saving changes
+    std::tm day = *std::localtime(&from);
+    day.tm_hour = 0;
+    day.tm_min = 0;
+    day.tm_sec = 0;
+    day.tm_isdst = -1;
+
+    for (;;) {
+        std::tm probe = day;
+        std::time_t midnight = std::mktime(&probe);
+        if (midnight >= to) {
+            break;
+        }
+
+        if (probe.tm_wday == weekday) {
+            std::tm shiftStart = day;
+            shiftStart.tm_min = startMinute;
+            shiftStart.tm_isdst = -1;
+            std::tm shiftEnd = day;
+            shiftEnd.tm_min = endMinute;
+            shiftEnd.tm_isdst = -1;
+
+            std::time_t start = std::max(from, std::mktime(&shiftStart));
+            std::time_t end = std::min(to, std::mktime(&shiftEnd));
+            addRange(start, end, onCall);
+        }
+
+        day.tm_mday++;
+    }
+}
+
+void ShiftCalendar::clear() {
+    pages.clear();
+    holidays.clear();
+}
+
+std::int64_t ShiftCalendar::firstUnavailable(std::int64_t firstBucket, std::int64_t lastBucket,
+                                             bool includeOnCall) const {
+    std::int64_t bucket = firstBucket;
+    while (bucket < lastBucket) {
+        std::int64_t pageIndex = floorDiv(bucket, BUCKETS_PER_PAGE);
+        auto pageIt = pages.find(pageIndex);
+        if (pageIt == pages.end()) {
+            return bucket;
+        }
+
+        std::int64_t offset = bucket - pageIndex * BUCKETS_PER_PAGE;
+        std::int64_t stop = std::min(lastBucket, (pageIndex + 1) * BUCKETS_PER_PAGE);
+        const Page& page = pageIt->second;
+
+        while (bucket < stop) {
+            size_t word = static_cast<size_t>(offset / 64);
+            unsigned from = static_cast<unsigned>(offset % 64);
+            unsigned to = static_cast<unsigned>(std::min<std::int64_t>(64, from + (stop - bucket)));
+            std::uint64_t mask = bitRange(from, to);
+
+            std::uint64_t available = page.working[word] | (includeOnCall ? page.onCall[word] : 0);
+            std::uint64_t missing = mask & ~available;
+            if (missing != 0) {
+                return bucket + (lowestBit(missing) - from);
+            }
+
+            bucket += to - from;
+            offset += to - from;
+        }
+    }
+    return lastBucket;
+}
+
+std::int64_t ShiftCalendar::firstAvailable(std::int64_t firstBucket, std::int64_t lastBucket,
+                                           bool includeOnCall) const {
+    std::int64_t bucket = firstBucket;
+    while (bucket < lastBucket) {
+        std::int64_t pageIndex = floorDiv(bucket, BUCKETS_PER_PAGE);
+        std::int64_t stop = std::min(lastBucket, (pageIndex + 1) * BUCKETS_PER_PAGE);
+
+        // Untouched pages hold no working time: jump to the next stored page
+        auto pageIt = pages.find(pageIndex);
+        if (pageIt == pages.end()) {
+            auto nextIt = pages.upper_bound(pageIndex);
+            if (nextIt == pages.end()) {
+                return lastBucket;
+            }
+            bucket = std::max(bucket, nextIt->first * BUCKETS_PER_PAGE);
+            continue;
+        }
+
+        std::int64_t offset = bucket - pageIndex * BUCKETS_PER_PAGE;
+        const Page& page = pageIt->second;
+
+        while (bucket < stop) {
+            size_t word = static_cast<size_t>(offset / 64);
+            unsigned from = static_cast<unsigned>(offset % 64);
+            unsigned to = static_cast<unsigned>(std::min<std::int64_t>(64, from + (stop - bucket)));
+            std::uint64_t mask = bitRange(from, to);
+
+            std::uint64_t available = mask & (page.working[word] | (includeOnCall ? page.onCall[word] : 0));
+            if (available != 0) {
+                return bucket + (lowestBit(available) - from);
+            }
+
+            bucket += to - from;
+            offset += to - from;
+        }
+    }
+    return lastBucket;
+}
+
+bool ShiftCalendar::isAvailable(std::time_t start, int duration, bool includeOnCall) const {
+    std::time_t end = start + static_cast<std::time_t>(duration) * 60;
+    std::int64_t lastBucket = bucketEnd(end);
+    return firstUnavailable(bucketOf(start), lastBucket, includeOnCall) == lastBucket;
+}
+
+std::time_t ShiftCalendar::nextAvailable(std::time_t from, int duration, std::time_t limit,
+                                         bool includeOnCall) const {
+    std::time_t length = static_cast<std::time_t>(duration) * 60;
+    std::int64_t limitBucket = bucketEnd(limit);
+    std::time_t candidate = from;
+
+    while (candidate + length <= limit) {
+        std::int64_t lastBucket = bucketEnd(candidate + length);
+        std::int64_t blocked = firstUnavailable(bucketOf(candidate), lastBucket, includeOnCall);
+        if (blocked == lastBucket) {
+            return candidate;
+        }
+
+        // Restart at the next available bucket after the gap
+        std::int64_t resume = firstAvailable(blocked + 1, limitBucket, includeOnCall);
+        if (resume >= limitBucket) {
+            break;
+        }
+        candidate = static_cast<std::time_t>(resume * BUCKET_SECONDS);
+    }
+    return -1;
+}
+
+int ShiftCalendar::getAvailableMinutes(std::time_t from, std::time_t to, bool includeOnCall) const {
+    if (to <= from) {
+        return 0;
+    }
+
+    std::int64_t bucket = bucketOf(from);
+    std::int64_t lastBucket = bucketEnd(to);
+    std::int64_t count = 0;
+
+    while (bucket < lastBucket) {
+        std::int64_t pageIndex = floorDiv(bucket, BUCKETS_PER_PAGE);
+        std::int64_t stop = std::min(lastBucket, (pageIndex + 1) * BUCKETS_PER_PAGE);
+        auto pageIt = pages.find(pageIndex);
+        if (pageIt == pages.end()) {
+            bucket = stop;
+            continue;
+        }
+
+        std::int64_t offset = bucket - pageIndex * BUCKETS_PER_PAGE;
+        const Page& page = pageIt->second;
+        while (bucket < stop) {
+            size_t word = static_cast<size_t>(offset / 64);
+            unsigned start = static_cast<unsigned>(offset % 64);
+            unsigned end = static_cast<unsigned>(std::min<std::int64_t>(64, start + (stop - bucket)));
+            std::uint64_t available = page.working[word] | (includeOnCall ? page.onCall[word] : 0);
+
+            count += std::bitset<64>(available & bitRange(start, end)).count();
+            bucket += end - start;
+            offset += end - start;
+        }
+    }
+
+    return static_cast<int>(count * (BUCKET_SECONDS / 60));
+}
+
+size_t ShiftCalendar::getMemoryUsage() const {
+    return pages.size() * sizeof(Page) + holidays.capacity() * sizeof(holidays[0]);
+}
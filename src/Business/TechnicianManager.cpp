@@ -4,6 +4,7 @@
 
 #include "Business/TechnicianManager.h"
 #include <algorithm>
+#include <queue>
 
 TechnicianManager::TechnicianManager() {
     // Initialize if needed
@@ -30,8 +31,9 @@ bool TechnicianManager::removeTechnician(const std::string& technicianId) {
     // Remove the technician
     technicians.erase(it);
 
-    // Remove any assignments for this technician
+    // Remove any assignments and shifts for this technician
     assignments.erase(technicianId);
+    calendars.erase(technicianId);
 
     return true;
 }
@@ -49,13 +51,46 @@ const std::map<std::string, Technician>& TechnicianManager::getAllTechnicians()
     return technicians;
 }
 
+ShiftCalendar* TechnicianManager::getShiftCalendar(const std::string& technicianId) {
+    if (technicians.find(technicianId) == technicians.end()) {
+        return nullptr;
+    }
+
+    return &calendars[technicianId];
+}
+
+const ShiftCalendar* TechnicianManager::findShiftCalendar(const std::string& technicianId) const {
+    auto it = calendars.find(technicianId);
+    if (it == calendars.end()) {
+        return nullptr;
+    }
+
+    return &(it->second);
+}
+
+bool TechnicianManager::removeShiftCalendar(const std::string& technicianId) {
+    return calendars.erase(technicianId) > 0;
+}
+
+bool TechnicianManager::isOnShift(const std::string& technicianId, std::time_t date, int duration,
+                                  bool includeOnCall) const {
+    const ShiftCalendar* calendar = findShiftCalendar(technicianId);
+    return calendar == nullptr || calendar->isAvailable(date, duration, includeOnCall);
+}
+
 bool TechnicianManager::isTechnicianAvailable(const std::string& technicianId,
-                                           std::time_t date, int duration) const {
+                                           std::time_t date, int duration,
+                                           bool includeOnCall) const {
     // Check if technician exists
     if (technicians.find(technicianId) == technicians.end()) {
         return false;
     }
 
+    // Off-shift technicians are rejected with a few bitmap words, before the interval check
+    if (!isOnShift(technicianId, date, duration, includeOnCall)) {
+        return false;
+    }
+
     // Check if technician has assignments
     auto assignIt = assignments.find(technicianId);
     if (assignIt == assignments.end()) {
@@ -82,9 +117,10 @@ bool TechnicianManager::isTechnicianAvailable(const std::string& technicianId,
 }
 
 bool TechnicianManager::assignTechnician(const std::string& technicianId,
-                                      std::time_t date, int duration) {
+                                      std::time_t date, int duration,
+                                      bool includeOnCall) {
     // Check if technician is available
-    if (!isTechnicianAvailable(technicianId, date, duration)) {
+    if (!isTechnicianAvailable(technicianId, date, duration, includeOnCall)) {
         return false;
     }
 
@@ -118,8 +154,34 @@ bool TechnicianManager::unassignTechnician(const std::string& technicianId, std:
     return true;
 }
 
+std::vector<std::pair<std::time_t, int>> TechnicianManager::getOverlappingAssignments(const std::string& technicianId,
+                                                                                    std::time_t date,
+                                                                                    int duration) const {
+    std::vector<std::pair<std::time_t, int>> overlapping;
+    auto assignIt = assignments.find(technicianId);
+    if (assignIt == assignments.end()) {
+        return overlapping;
+    }
+
+    // Assignments starting before the end of the window, walked backwards:
+    // they never overlap, so the first one ending before the window is the last to check
+    const auto& techAssignments = assignIt->second;
+    std::time_t requestedEnd = date + duration * 60;
+    for (auto it = techAssignments.lower_bound(requestedEnd); it != techAssignments.begin();) {
+        --it;
+        if (it->first + it->second * 60 <= date) {
+            break;
+        }
+        overlapping.emplace_back(it->first, it->second);
+    }
+
+    std::reverse(overlapping.begin(), overlapping.end());
+    return overlapping;
+}
+
 std::vector<std::string> TechnicianManager::findAvailableTechnicians(std::time_t date, int duration,
-                                                                  const std::string& specialty) const {
+                                                                  const std::string& specialty,
+                                                                  bool includeOnCall) const {
     std::vector<std::string> availableTechnicians;
 
     // Check each technician
@@ -133,10 +195,95 @@ std::vector<std::string> TechnicianManager::findAvailableTechnicians(std::time_t
         }
 
         // Check availability
-        if (isTechnicianAvailable(techId, date, duration)) {
+        if (isTechnicianAvailable(techId, date, duration, includeOnCall)) {
             availableTechnicians.push_back(techId);
         }
     }
 
     return availableTechnicians;
-}
\ No newline at end of file
+}
+
+std::vector<TechnicianManager::SlotOption> TechnicianManager::findEarliestSlots(int duration,
+                                                                              const std::string& specialty,
+                                                                              std::time_t notBefore,
+                                                                              std::time_t horizon,
+                                                                              size_t count,
+                                                                              bool includeOnCall) const {
+    std::vector<SlotOption> options;
+    if (count == 0 || duration <= 0) {
+        return options;
+    }
+
+    const std::time_t length = static_cast<std::time_t>(duration) * 60;
+    const std::map<std::time_t, int> noAssignments;
+
+    // Sweep state of one technician: candidate start and next busy interval
+    struct Cursor {
+        std::time_t candidate;
+        const std::string* technicianId;
+        std::map<std::time_t, int>::const_iterator next;
+        std::map<std::time_t, int>::const_iterator end;
+    };
+    auto later = [](const Cursor& a, const Cursor& b) {
+        if (a.candidate != b.candidate) {
+            return a.candidate > b.candidate;
+        }
+        return *a.technicianId > *b.technicianId;
+    };
+    std::priority_queue<Cursor, std::vector<Cursor>, decltype(later)> sweep(later);
+
+    for (const auto& techPair : technicians) {
+        if (!specialty.empty() && techPair.second.getSpecialty() != specialty) {
+            continue;
+        }
+
+        auto assignIt = assignments.find(techPair.first);
+        const auto& busy = assignIt != assignments.end() ? assignIt->second : noAssignments;
+
+        // The assignment just before notBefore may still be running
+        auto next = busy.lower_bound(notBefore);
+        if (next != busy.begin()) {
+            --next;
+        }
+        sweep.push({notBefore, &techPair.first, next, busy.end()});
+    }
+
+    while (!sweep.empty() && options.size() < count) {
+        Cursor cursor = sweep.top();
+        sweep.pop();
+
+        // Every remaining candidate starts too late
+        if (cursor.candidate + length > horizon) {
+            break;
+        }
+
+        // Skip assignments that end before the candidate start
+        while (cursor.next != cursor.end &&
+               cursor.next->first + cursor.next->second * 60 <= cursor.candidate) {
+            ++cursor.next;
+        }
+
+        if (cursor.next == cursor.end || cursor.next->first >= cursor.candidate + length) {
+            // Free of assignments: move to the next shift window if off duty
+            const ShiftCalendar* calendar = findShiftCalendar(*cursor.technicianId);
+            if (calendar && !calendar->isAvailable(cursor.candidate, duration, includeOnCall)) {
+                std::time_t onShift = calendar->nextAvailable(cursor.candidate, duration, horizon, includeOnCall);
+                if (onShift >= 0) {
+                    cursor.candidate = onShift;
+                    sweep.push(cursor);
+                }
+                continue;
+            }
+
+            options.push_back({cursor.candidate, *cursor.technicianId});
+            continue;
+        }
+
+        // Busy: try again right after this assignment
+        cursor.candidate = cursor.next->first + cursor.next->second * 60;
+        ++cursor.next;
+        sweep.push(cursor);
+    }
+
+    return options;
+}
@@ -0,0 +1,173 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/TimerWheel.h"
+#include <algorithm>
+#include <utility>
+
+TimerWheel::TimerWheel(std::time_t startTime)
+    : slots(static_cast<size_t>(SLOTS_PER_LEVEL) * LEVEL_COUNT, NIL), currentTime(startTime), activeCount(0) {
+}
+
+TimerWheel::TimerId TimerWheel::schedule(std::time_t deadline, Callback callback) {
+    // Timers already due fire on the next advance
+    if (deadline <= currentTime) {
+        deadline = currentTime + 1;
+    }
+
+    std::uint32_t index;
+    if (!freeNodes.empty()) {
+        index = freeNodes.back();
+        freeNodes.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(nodes.size());
+        nodes.emplace_back();
+    }
+
+    Node& node = nodes[index];
+    node.deadline = deadline;
+    node.callback = std::move(callback);
+    link(index);
+    activeCount++;
+
+    // Encode generation and index so stale IDs never cancel a reused node
+    return (static_cast<TimerId>(node.generation) << 32) | index;
+}
+
+bool TimerWheel::cancel(TimerId timerId) {
+    std::uint32_t index = static_cast<std::uint32_t>(timerId & 0xFFFFFFFFu);
+    std::uint32_t generation = static_cast<std::uint32_t>(timerId >> 32);
+
+    if (timerId == INVALID_TIMER || index >= nodes.size()) {
+        return false;
+    }
+
+    Node& node = nodes[index];
+    if (node.slot == NIL || node.generation != generation) {
+        return false; // Already fired or cancelled
+    }
+
+    unlink(index);
+    release(index);
+    return true;
+}
+
+size_t TimerWheel::advance(std::time_t now) {
+    if (now <= currentTime) {
+        return 0;
+    }
+
+    std::vector<Callback> due;
+
+    while (currentTime < now) {
+        // Nothing pending: jump straight to the target time
+        if (activeCount == 0) {
+            currentTime = now;
+            break;
+        }
+
+        currentTime++;
+        std::uint64_t tick = static_cast<std::uint64_t>(currentTime);
+
+        // When a level wraps, bring the matching slot of the level above down
+        for (unsigned level = 1; level < LEVEL_COUNT; ++level) {
+            if ((tick & ((std::uint64_t(1) << (LEVEL_BITS * level)) - 1)) != 0) {
+                break;
+            }
+            cascade(level, static_cast<unsigned>((tick >> (LEVEL_BITS * level)) & (SLOTS_PER_LEVEL - 1)));
+        }
+
+        // Everything left in the level-0 slot is due now
+        std::uint32_t slot = static_cast<std::uint32_t>(tick & (SLOTS_PER_LEVEL - 1));
+        std::uint32_t index = slots[slot];
+        while (index != NIL) {
+            std::uint32_t next = nodes[index].next;
+            due.push_back(std::move(nodes[index].callback));
+            unlink(index);
+            release(index);
+            index = next;
+        }
+    }
+
+    // Fire after the wheel is consistent so callbacks can schedule or cancel timers
+    for (auto& callback : due) {
+        if (callback) {
+            callback();
+        }
+    }
+
+    return due.size();
+}
+
+size_t TimerWheel::size() const {
+    return activeCount;
+}
+
+std::time_t TimerWheel::getCurrentTime() const {
+    return currentTime;
+}
+
+void TimerWheel::link(std::uint32_t index) {
+    Node& node = nodes[index];
+    std::uint64_t deadline = static_cast<std::uint64_t>(node.deadline);
+    std::uint64_t delta = deadline - static_cast<std::uint64_t>(currentTime);
+
+    // Pick the lowest level whose span covers the delay
+    unsigned level = 0;
+    while (level + 1 < LEVEL_COUNT && delta >= (std::uint64_t(1) << (LEVEL_BITS * (level + 1)))) {
+        level++;
+    }
+
+    std::uint32_t slot = level * SLOTS_PER_LEVEL +
+        static_cast<std::uint32_t>((deadline >> (LEVEL_BITS * level)) & (SLOTS_PER_LEVEL - 1));
+
+    node.slot = slot;
+    node.prev = NIL;
+    node.next = slots[slot];
+    if (node.next != NIL) {
+        nodes[node.next].prev = index;
+    }
+    slots[slot] = index;
+}
+
+void TimerWheel::cascade(unsigned level, unsigned slot) {
+    std::uint32_t flatSlot = level * SLOTS_PER_LEVEL + slot;
+    std::uint32_t index = slots[flatSlot];
+    slots[flatSlot] = NIL;
+
+    // Relink every timer relative to the current time; they land on lower levels
+    while (index != NIL) {
+        std::uint32_t next = nodes[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+void TimerWheel::unlink(std::uint32_t index) {
+    Node& node = nodes[index];
+
+    if (node.prev != NIL) {
+        nodes[node.prev].next = node.next;
+    } else {
+        slots[node.slot] = node.next;
+    }
+    if (node.next != NIL) {
+        nodes[node.next].prev = node.prev;
+    }
+
+    node.prev = NIL;
+    node.next = NIL;
+}
+
+void TimerWheel::release(std::uint32_t index) {
+    Node& node = nodes[index];
+    node.slot = NIL;
+    node.callback = nullptr;
+    node.generation++;
+    if (node.generation == 0) {
+        node.generation = 1; // Keep IDs distinct from INVALID_TIMER
+    }
+    freeNodes.push_back(index);
+    activeCount--;
+}
@@ -0,0 +1,290 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/TrackAnalytics.h"
+#include "Business/GeoUtils.h"
+#include <cmath>
+#include <algorithm>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define TRACK_ANALYTICS_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+
+// Central angle between two points (radians in, radians out)
+double centralAngle(double lat1, double lon1, double cosLat1, double lat2, double lon2, double cosLat2) {
+    double sinLat = std::sin((lat2 - lat1) / 2);
+    double sinLon = std::sin((lon2 - lon1) / 2);
+    double a = sinLat * sinLat + cosLat1 * cosLat2 * sinLon * sinLon;
+    return 2 * std::asin(std::sqrt(std::min(1.0, a)));
+}
+
+#ifdef TRACK_ANALYTICS_AVX2
+
+// Largest sqrt(a) handled by the arcsine polynomial (about 2,500 km);
+// longer hops are recomputed with the scalar formula
+const double ASIN_POLY_LIMIT = 0.2;
+
+// sin² of half angle differences, valid for |x| <= pi
+__attribute__((target("avx2,fma")))
+inline __m256d sinSquared(__m256d x) {
+    const __m256d pi = _mm256_set1_pd(3.14159265358979323846);
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+
+    // sin²(x) = sin²(|x|) = sin²(pi - |x|): fold into [0, pi/2]
+    __m256d ax = _mm256_andnot_pd(signMask, x);
+    ax = _mm256_min_pd(ax, _mm256_sub_pd(pi, ax));
+
+    // Taylor series up to x^17, error below 5e-14 on [0, pi/2]
+    __m256d x2 = _mm256_mul_pd(ax, ax);
+    __m256d p = _mm256_set1_pd(1.0 / 355687428096000.0);
+    p = _mm256_fmadd_pd(p, x2, _mm256_set1_pd(-1.0 / 1307674368000.0));
+    p = _mm256_fmadd_pd(p, x2, _mm256_set1_pd(1.0 / 6227020800.0));
+    p = _mm256_fmadd_pd(p, x2, _mm256_set1_pd(-1.0 / 39916800.0));
+    p = _mm256_fmadd_pd(p, x2, _mm256_set1_pd(1.0 / 362880.0));
+    p = _mm256_fmadd_pd(p, x2, _mm256_set1_pd(-1.0 / 5040.0));
+    p = _mm256_fmadd_pd(p, x2, _mm256_set1_pd(1.0 / 120.0));
+    p = _mm256_fmadd_pd(p, x2, _mm256_set1_pd(-1.0 / 6.0));
+    p = _mm256_fmadd_pd(p, x2, _mm256_set1_pd(1.0));
+    __m256d s = _mm256_mul_pd(p, ax);
+    return _mm256_mul_pd(s, s);
+}
+
+// 2 * asin(sqrt(a)) for sqrt(a) <= ASIN_POLY_LIMIT
+__attribute__((target("avx2,fma")))
+inline __m256d angleFromHaversine(__m256d a) {
+    __m256d y = _mm256_sqrt_pd(a);
+    __m256d y2 = _mm256_mul_pd(y, y);
+
+    // Taylor series of asin up to y^15
+    __m256d p = _mm256_set1_pd(143.0 / 10240.0);
+    p = _mm256_fmadd_pd(p, y2, _mm256_set1_pd(231.0 / 13312.0));
+    p = _mm256_fmadd_pd(p, y2, _mm256_set1_pd(63.0 / 2816.0));
+    p = _mm256_fmadd_pd(p, y2, _mm256_set1_pd(35.0 / 1152.0));
+    p = _mm256_fmadd_pd(p, y2, _mm256_set1_pd(5.0 / 112.0));
+    p = _mm256_fmadd_pd(p, y2, _mm256_set1_pd(3.0 / 40.0));
+    p = _mm256_fmadd_pd(p, y2, _mm256_set1_pd(1.0 / 6.0));
+    p = _mm256_fmadd_pd(p, y2, _mm256_set1_pd(1.0));
+    return _mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_mul_pd(p, y));
+}
+
+// Central angles between (lat1, lon1) and (lat2, lon2) four lanes at a time;
+// returns a bitmask of lanes that exceed the polynomial range
+__attribute__((target("avx2,fma")))
+inline int angleLanes(__m256d lat1, __m256d lon1, __m256d cos1,
+                      __m256d lat2, __m256d lon2, __m256d cos2, double* out) {
+    const __m256d half = _mm256_set1_pd(0.5);
+    __m256d sLat = sinSquared(_mm256_mul_pd(_mm256_sub_pd(lat2, lat1), half));
+    __m256d sLon = sinSquared(_mm256_mul_pd(_mm256_sub_pd(lon2, lon1), half));
+    __m256d a = _mm256_fmadd_pd(_mm256_mul_pd(cos1, cos2), sLon, sLat);
+
+    __m256d limit = _mm256_set1_pd(ASIN_POLY_LIMIT * ASIN_POLY_LIMIT);
+    int tooFar = _mm256_movemask_pd(_mm256_cmp_pd(a, limit, _CMP_GT_OQ));
+    _mm256_storeu_pd(out, angleFromHaversine(_mm256_min_pd(a, limit)));
+    return tooFar;
+}
+
+// Angles between consecutive points: out[i] = angle(i, i + 1)
+__attribute__((target("avx2,fma")))
+void segmentAnglesAvx2(const double* lat, const double* lon, const double* cosLat, size_t segments, double* out) {
+    size_t i = 0;
+    for (; i + 4 <= segments; i += 4) {
+        int tooFar = angleLanes(_mm256_loadu_pd(lat + i), _mm256_loadu_pd(lon + i), _mm256_loadu_pd(cosLat + i),
+                                _mm256_loadu_pd(lat + i + 1), _mm256_loadu_pd(lon + i + 1),
+                                _mm256_loadu_pd(cosLat + i + 1), out + i);
+        for (int lane = 0; tooFar != 0; ++lane, tooFar >>= 1) {
+            if (tooFar & 1) {
+                size_t k = i + lane;
+                out[k] = centralAngle(lat[k], lon[k], cosLat[k], lat[k + 1], lon[k + 1], cosLat[k + 1]);
+            }
+        }
+    }
+    for (; i < segments; ++i) {
+        out[i] = centralAngle(lat[i], lon[i], cosLat[i], lat[i + 1], lon[i + 1], cosLat[i + 1]);
+    }
+}
+
+// Angles from every point to one location
+__attribute__((target("avx2,fma")))
+void pointAnglesAvx2(const double* lat, const double* lon, const double* cosLat, size_t count,
+                     double siteLat, double siteLon, double siteCos, double* out) {
+    const __m256d lat2 = _mm256_set1_pd(siteLat);
+    const __m256d lon2 = _mm256_set1_pd(siteLon);
+    const __m256d cos2 = _mm256_set1_pd(siteCos);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        int tooFar = angleLanes(_mm256_loadu_pd(lat + i), _mm256_loadu_pd(lon + i), _mm256_loadu_pd(cosLat + i),
+                                lat2, lon2, cos2, out + i);
+        for (int lane = 0; tooFar != 0; ++lane, tooFar >>= 1) {
+            if (tooFar & 1) {
+                size_t k = i + lane;
+                out[k] = centralAngle(lat[k], lon[k], cosLat[k], siteLat, siteLon, siteCos);
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        out[i] = centralAngle(lat[i], lon[i], cosLat[i], siteLat, siteLon, siteCos);
+    }
+}
+
+#endif // TRACK_ANALYTICS_AVX2
+
+} // namespace
+
+TrackAnalytics::TrackAnalytics(const std::vector<TrackPoint>& track, bool allowSimd)
+    : useAvx2(allowSimd && isAvx2Supported()) {
+    size_t count = track.size();
+    latitudes.resize(count);
+    longitudes.resize(count);
+    cosLatitudes.resize(count);
+    timestamps.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        latitudes[i] = track[i].latitude * DEG_TO_RAD;
+        longitudes[i] = track[i].longitude * DEG_TO_RAD;
+        cosLatitudes[i] = std::cos(latitudes[i]);
+        timestamps[i] = static_cast<std::int64_t>(track[i].timestamp);
+    }
+
+    // Segment lengths feed distance, speed and dwell: compute them once
+    size_t segments = count > 1 ? count - 1 : 0;
+    segmentKm.resize(segments);
+#ifdef TRACK_ANALYTICS_AVX2
+    if (useAvx2) {
+        segmentAnglesAvx2(latitudes.data(), longitudes.data(), cosLatitudes.data(), segments, segmentKm.data());
+    } else
+#endif
+    {
+        for (size_t i = 0; i < segments; ++i) {
+            segmentKm[i] = centralAngle(latitudes[i], longitudes[i], cosLatitudes[i],
+                                        latitudes[i + 1], longitudes[i + 1], cosLatitudes[i + 1]);
+        }
+    }
+
+    for (double& km : segmentKm) {
+        km *= GeoUtils::EARTH_RADIUS_KM;
+    }
+}
+
+bool TrackAnalytics::isAvx2Supported() {
+#ifdef TRACK_ANALYTICS_AVX2
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+bool TrackAnalytics::isVectorized() const {
+    return useAvx2;
+}
+
+std::vector<double> TrackAnalytics::distancesTo(double latitude, double longitude) const {
+    size_t count = latitudes.size();
+    std::vector<double> distances(count);
+    double siteLat = latitude * DEG_TO_RAD;
+    double siteLon = longitude * DEG_TO_RAD;
+    double siteCos = std::cos(siteLat);
+
+#ifdef TRACK_ANALYTICS_AVX2
+    if (useAvx2) {
+        pointAnglesAvx2(latitudes.data(), longitudes.data(), cosLatitudes.data(), count,
+                        siteLat, siteLon, siteCos, distances.data());
+    } else
+#endif
+    {
+        for (size_t i = 0; i < count; ++i) {
+            distances[i] = centralAngle(latitudes[i], longitudes[i], cosLatitudes[i], siteLat, siteLon, siteCos);
+        }
+    }
+
+    for (double& km : distances) {
+        km *= GeoUtils::EARTH_RADIUS_KM;
+    }
+    return distances;
+}
+
+double TrackAnalytics::getTotalDistanceKm() const {
+    double total = 0;
+    for (double km : segmentKm) {
+        total += km;
+    }
+    return total;
+}
+
+double TrackAnalytics::getMaxSpeedKmh() const {
+    double maxSpeed = 0;
+    for (size_t i = 0; i < segmentKm.size(); ++i) {
+        std::int64_t seconds = timestamps[i + 1] - timestamps[i];
+        if (seconds > 0) {
+            maxSpeed = std::max(maxSpeed, segmentKm[i] * 3600.0 / static_cast<double>(seconds));
+        }
+    }
+    return maxSpeed;
+}
+
+double TrackAnalytics::getAverageSpeedKmh() const {
+    if (timestamps.size() < 2 || timestamps.back() <= timestamps.front()) {
+        return 0;
+    }
+    return getTotalDistanceKm() * 3600.0 / static_cast<double>(timestamps.back() - timestamps.front());
+}
+
+double TrackAnalytics::getDistanceToSiteKm(double latitude, double longitude) const {
+    if (latitudes.empty()) {
+        return -1;
+    }
+
+    double siteLat = latitude * DEG_TO_RAD;
+    return GeoUtils::EARTH_RADIUS_KM * centralAngle(latitudes.back(), longitudes.back(), cosLatitudes.back(),
+                                                    siteLat, longitude * DEG_TO_RAD, std::cos(siteLat));
+}
+
+std::time_t TrackAnalytics::getDwellSeconds(double latitude, double longitude, double radiusKm) const {
+    std::vector<double> distances = distancesTo(latitude, longitude);
+
+    std::int64_t dwell = 0;
+    for (size_t i = 0; i + 1 < distances.size(); ++i) {
+        if (distances[i] <= radiusKm && distances[i + 1] <= radiusKm) {
+            dwell += timestamps[i + 1] - timestamps[i];
+        }
+    }
+    return static_cast<std::time_t>(dwell);
+}
+
+TrackAnalytics::Summary TrackAnalytics::summarize(bool hasSite, double siteLatitude, double siteLongitude,
+                                                  double siteRadiusKm) const {
+    Summary summary;
+    summary.points = latitudes.size();
+    summary.totalDistanceKm = getTotalDistanceKm();
+    summary.maxSpeedKmh = getMaxSpeedKmh();
+    summary.averageSpeedKmh = getAverageSpeedKmh();
+    if (timestamps.size() > 1) {
+        summary.durationSeconds = static_cast<std::time_t>(timestamps.back() - timestamps.front());
+    }
+
+    if (!hasSite || latitudes.empty()) {
+        return summary;
+    }
+
+    // One pass over the site distances gives approach, dwell and current distance
+    std::vector<double> distances = distancesTo(siteLatitude, siteLongitude);
+    summary.hasSite = true;
+    summary.distanceToSiteKm = distances.back();
+    summary.closestApproachKm = *std::min_element(distances.begin(), distances.end());
+
+    std::int64_t dwell = 0;
+    for (size_t i = 0; i + 1 < distances.size(); ++i) {
+        if (distances[i] <= siteRadiusKm && distances[i + 1] <= siteRadiusKm) {
+            dwell += timestamps[i + 1] - timestamps[i];
+        }
+    }
+    summary.dwellSeconds = static_cast<std::time_t>(dwell);
+    return summary;
+}
@@ -0,0 +1,258 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/TrackSimplifier.h"
+#include "Business/GeoUtils.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+const double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+
+// Local equirectangular projection in meters, accurate over a few kilometers
+struct Projected {
+    double x;
+    double y;
+};
+
+Projected project(const TrackPoint& point, double cosReference) {
+    const double metersPerRadian = GeoUtils::EARTH_RADIUS_KM * 1000.0;
+    return {point.longitude * DEG_TO_RAD * cosReference * metersPerRadian,
+            point.latitude * DEG_TO_RAD * metersPerRadian};
+}
+
+double segmentDistance(const Projected& p, const Projected& a, const Projected& b) {
+    double dx = b.x - a.x;
+    double dy = b.y - a.y;
+    double lengthSquared = dx * dx + dy * dy;
+    if (lengthSquared == 0) {
+        return std::hypot(p.x - a.x, p.y - a.y);
+    }
+
+    double t = std::max(0.0, std::min(1.0, ((p.x - a.x) * dx + (p.y - a.y) * dy) / lengthSquared));
+    return std::hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy));
+}
+
+} // namespace
+
+TrackSimplifier::TrackSimplifier(double toleranceMeters)
+    : toleranceMeters(toleranceMeters), origin(0), pointCount(0) {
+}
+
+TrackSimplifier::StoredPoint TrackSimplifier::store(const TrackPoint& point) const {
+    return {static_cast<std::int32_t>(std::llround(point.latitude * CompressedTrack::COORDINATE_SCALE)),
+            static_cast<std::int32_t>(std::llround(point.longitude * CompressedTrack::COORDINATE_SCALE)),
+            static_cast<std::int32_t>(point.timestamp - origin)};
+}
+
+TrackPoint TrackSimplifier::load(const StoredPoint& point) const {
+    return TrackPoint(point.latitude / CompressedTrack::COORDINATE_SCALE,
+                      point.longitude / CompressedTrack::COORDINATE_SCALE,
+                      origin + point.offset);
+}
+
+std::vector<TrackPoint> TrackSimplifier::loadAll(const std::vector<StoredPoint>& level) const {
+    std::vector<TrackPoint> points;
+    points.reserve(level.size());
+    for (const auto& point : level) {
+        points.push_back(load(point));
+    }
+    return points;
+}
+
+void TrackSimplifier::add(const TrackPoint& point) {
+    if (pointCount == 0) {
+        origin = point.timestamp;
+    }
+    pointCount++;
+
+    StoredPoint stored = store(point);
+    addToLevel(minuteLevel, stored, 60);
+    addToLevel(hourLevel, stored, 3600);
+
+    // The first point is the first anchor
+    if (simplified.empty()) {
+        simplified.push_back(stored);
+        return;
+    }
+
+    pending.push_back(stored);
+    if (pending.size() == CHUNK_SIZE) {
+        simplifyPending();
+    }
+}
+
+void TrackSimplifier::simplifyPending() {
+    std::vector<TrackPoint> chunk;
+    chunk.reserve(pending.size() + 1);
+    chunk.push_back(load(simplified.back()));
+    for (const auto& point : pending) {
+        chunk.push_back(load(point));
+    }
+
+    // The anchor is already kept: append the rest, the last point becomes the new anchor
+    std::vector<TrackPoint> kept = douglasPeucker(chunk, toleranceMeters);
+    for (size_t i = 1; i < kept.size(); ++i) {
+        simplified.push_back(store(kept[i]));
+    }
+    pending.clear();
+}
+
+void TrackSimplifier::addToLevel(std::vector<StoredPoint>& level, const StoredPoint& point,
+                                 std::time_t periodSeconds) const {
+    // The very first fix is never replaced, so levels start where the track starts
+    if (level.size() > 1 &&
+        (origin + level.back().offset) / periodSeconds == (origin + point.offset) / periodSeconds) {
+        level.back() = point;
+    } else {
+        level.push_back(point);
+    }
+}
+
+void TrackSimplifier::clear() {
+    simplified.clear();
+    pending.clear();
+    minuteLevel.clear();
+    hourLevel.clear();
+    origin = 0;
+    pointCount = 0;
+}
+
+double TrackSimplifier::getTolerance() const {
+    return toleranceMeters;
+}
+
+void TrackSimplifier::setTolerance(double meters) {
+    toleranceMeters = std::max(0.0, meters);
+}
+
+size_t TrackSimplifier::getPointCount() const {
+    return pointCount;
+}
+
+std::vector<TrackPoint> TrackSimplifier::getSimplified() const {
+    std::vector<TrackPoint> result = loadAll(simplified);
+    if (!pending.empty()) {
+        std::vector<TrackPoint> chunk;
+        chunk.push_back(result.back());
+        for (const auto& point : pending) {
+            chunk.push_back(load(point));
+        }
+
+        std::vector<TrackPoint> kept = douglasPeucker(chunk, toleranceMeters);
+        result.insert(result.end(), kept.begin() + 1, kept.end());
+    }
+    return result;
+}
+
+std::vector<TrackPoint> TrackSimplifier::getMinuteLevel() const {
+    return loadAll(minuteLevel);
+}
+
+std::vector<TrackPoint> TrackSimplifier::getHourLevel() const {
+    return loadAll(hourLevel);
+}
+
+size_t TrackSimplifier::getMemoryUsage() const {
+    return sizeof(*this) + (simplified.capacity() + pending.capacity() + minuteLevel.capacity() +
+                            hourLevel.capacity()) * sizeof(StoredPoint);
+}
+
+std::vector<TrackPoint> TrackSimplifier::sample(const std::vector<StoredPoint>& level,
+                                                const std::vector<StoredPoint>& rest, size_t budget) const {
+    size_t count = level.size() + rest.size();
+    auto at = [&](size_t i) { return load(i < level.size() ? level[i] : rest[i - level.size()]); };
+
+    std::vector<TrackPoint> result;
+    if (count == 0 || budget == 0) {
+        return result;
+    }
+    if (budget == 1) {
+        result.push_back(at(count - 1));
+        return result;
+    }
+
+    size_t taken = std::min(budget, count);
+    result.reserve(taken);
+    size_t last = count - 1;
+    for (size_t i = 0; i < taken; ++i) {
+        result.push_back(at(taken == count ? i : i * last / (taken - 1)));
+    }
+    return result;
+}
+
+std::vector<TrackPoint> TrackSimplifier::getWithBudget(size_t budget) const {
+    // The Douglas-Peucker level is sized and sampled without simplifying the
+    // pending chunk, which is at most CHUNK_SIZE points
+    size_t sizes[3] = {hourLevel.size(), minuteLevel.size(), simplified.size() + pending.size()};
+
+    // Smallest level that still fills the budget, or the largest one
+    int chosen = -1;
+    for (int level = 0; level < 3; ++level) {
+        if (sizes[level] >= budget && (chosen < 0 || sizes[level] < sizes[chosen])) {
+            chosen = level;
+        }
+    }
+    if (chosen < 0) {
+        chosen = static_cast<int>(std::max_element(sizes, sizes + 3) - sizes);
+    }
+
+    static const std::vector<StoredPoint> none;
+    if (chosen == 0) {
+        return sample(hourLevel, none, budget);
+    }
+    if (chosen == 1) {
+        return sample(minuteLevel, none, budget);
+    }
+    return sample(simplified, pending, budget);
+}
+
+std::vector<TrackPoint> TrackSimplifier::douglasPeucker(const std::vector<TrackPoint>& points,
+                                                        double toleranceMeters) {
+    if (points.size() <= 2) {
+        return points;
+    }
+
+    double cosReference = std::cos(points.front().latitude * DEG_TO_RAD);
+    std::vector<Projected> projected;
+    projected.reserve(points.size());
+    for (const auto& point : points) {
+        projected.push_back(project(point, cosReference));
+    }
+
+    std::vector<char> keep(points.size(), 0);
+    keep.front() = keep.back() = 1;
+
+    // Explicit stack: long tracks would overflow a recursive version
+    std::vector<std::pair<size_t, size_t>> ranges{{0, points.size() - 1}};
+    while (!ranges.empty()) {
+        auto [first, last] = ranges.back();
+        ranges.pop_back();
+
+        double maxDistance = 0;
+        size_t farthest = first;
+        for (size_t i = first + 1; i < last; ++i) {
+            double distance = segmentDistance(projected[i], projected[first], projected[last]);
+            if (distance > maxDistance) {
+                maxDistance = distance;
+                farthest = i;
+            }
+        }
+
+        if (maxDistance > toleranceMeters) {
+            keep[farthest] = 1;
+            ranges.push_back({first, farthest});
+            ranges.push_back({farthest, last});
+        }
+    }
+
+    std::vector<TrackPoint> result;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (keep[i]) {
+            result.push_back(points[i]);
+        }
+    }
+    return result;
+}
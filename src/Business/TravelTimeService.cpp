@@ -0,0 +1,284 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Business/TravelTimeService.h"
+#include "Business/GeoUtils.h"
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+const double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+
+// Travel time is symmetric: key on the unordered pair
+std::uint64_t pairKey(TravelTimeService::LocationId a, TravelTimeService::LocationId b) {
+    if (a > b) {
+        std::swap(a, b);
+    }
+    return (static_cast<std::uint64_t>(a) << 32) | b;
+}
+
+} // namespace
+
+TravelTimeService::TravelTimeService(size_t cacheCapacity, double roadFactor, double averageSpeedKmh)
+    : cacheCapacity(std::max<size_t>(1, cacheCapacity)), cacheHits(0), cacheMisses(0),
+      roadFactor(roadFactor), averageSpeedKmh(averageSpeedKmh) {
+}
+
+TravelTimeService::LocationId TravelTimeService::internLocked(const std::string& location) {
+    auto it = locationIds.find(location);
+    if (it != locationIds.end()) {
+        return it->second;
+    }
+
+    LocationId id = static_cast<LocationId>(locationNames.size());
+    locationIds.emplace(location, id);
+    locationNames.push_back(location);
+    sinLat.push_back(0);
+    cosLat.push_back(0);
+    sinLon.push_back(0);
+    cosLon.push_back(0);
+    versions.push_back(0);
+    return id;
+}
+
+TravelTimeService::LocationId TravelTimeService::intern(const std::string& location) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return internLocked(location);
+}
+
+TravelTimeService::LocationId TravelTimeService::findLocation(const std::string& location) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = locationIds.find(location);
+    return it != locationIds.end() ? it->second : INVALID_LOCATION;
+}
+
+TravelTimeService::LocationId TravelTimeService::setCoordinates(const std::string& location,
+                                                                double latitude, double longitude) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    LocationId id = internLocked(location);
+    double lat = latitude * DEG_TO_RAD;
+    double lon = longitude * DEG_TO_RAD;
+    sinLat[id] = std::sin(lat);
+    cosLat[id] = std::cos(lat);
+    sinLon[id] = std::sin(lon);
+    cosLon[id] = std::cos(lon);
+
+    // Cached pairs recorded the previous version and will be dropped on access
+    versions[id]++;
+    return id;
+}
+
+bool TravelTimeService::getCoordinates(LocationId id, double& latitude, double& longitude) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (id >= versions.size() || versions[id] == 0) {
+        return false;
+    }
+
+    latitude = std::atan2(sinLat[id], cosLat[id]) / DEG_TO_RAD;
+    longitude = std::atan2(sinLon[id], cosLon[id]) / DEG_TO_RAD;
+    return true;
+}
+
+bool TravelTimeService::isResolved(const std::string& location) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = locationIds.find(location);
+    return it != locationIds.end() && versions[it->second] != 0;
+}
+
+int TravelTimeService::loadGazetteer(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return -1;
+    }
+
+    int loaded = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        // Skip blank lines and comments
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream stream(line);
+        std::string name, latText, lonText;
+        if (!std::getline(stream, name, ';') || !std::getline(stream, latText, ';') ||
+            !std::getline(stream, lonText)) {
+            continue;
+        }
+
+        try {
+            setCoordinates(name, std::stod(latText), std::stod(lonText));
+            loaded++;
+        } catch (const std::exception& e) {
+            continue; // Malformed coordinates
+        }
+    }
+
+    return loaded;
+}
+
+double TravelTimeService::computeMinutes(LocationId from, LocationId to) const {
+    // Haversine term from precomputed trigonometry:
+    // sin²(Δ/2) = (1 - cos Δ) / 2 and cos Δ = cos a cos b + sin a sin b
+    double cosDLat = cosLat[from] * cosLat[to] + sinLat[from] * sinLat[to];
+    double cosDLon = cosLon[from] * cosLon[to] + sinLon[from] * sinLon[to];
+    double a = (1 - cosDLat) / 2 + cosLat[from] * cosLat[to] * (1 - cosDLon) / 2;
+
+    double km = 2 * GeoUtils::EARTH_RADIUS_KM * std::asin(std::sqrt(std::min(1.0, std::max(0.0, a))));
+    return km * roadFactor / averageSpeedKmh * 60;
+}
+
+bool TravelTimeService::lookupLocked(LocationId from, LocationId to, double& minutes) {
+    auto it = cacheIndex.find(pairKey(from, to));
+    if (it == cacheIndex.end()) {
+        return false;
+    }
+
+    const CacheEntry& entry = *it->second;
+    LocationId low = std::min(from, to);
+    LocationId high = std::max(from, to);
+    if (entry.fromVersion != versions[low] || entry.toVersion != versions[high]) {
+        // One of the locations moved since the entry was computed
+        lruList.erase(it->second);
+        cacheIndex.erase(it);
+        return false;
+    }
+
+    lruList.splice(lruList.begin(), lruList, it->second);
+    minutes = entry.minutes;
+    return true;
+}
+
+void TravelTimeService::storeLocked(LocationId from, LocationId to, double minutes) {
+    std::uint64_t key = pairKey(from, to);
+    LocationId low = std::min(from, to);
+    LocationId high = std::max(from, to);
+
+    auto it = cacheIndex.find(key);
+    if (it != cacheIndex.end()) {
+        *it->second = {key, versions[low], versions[high], minutes};
+        lruList.splice(lruList.begin(), lruList, it->second);
+        return;
+    }
+
+    if (cacheIndex.size() >= cacheCapacity) {
+        cacheIndex.erase(lruList.back().key);
+        lruList.pop_back();
+    }
+
+    lruList.push_front({key, versions[low], versions[high], minutes});
+    cacheIndex[key] = lruList.begin();
+}
+
+double TravelTimeService::getTravelMinutes(LocationId from, LocationId to) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (from >= versions.size() || to >= versions.size() || versions[from] == 0 || versions[to] == 0) {
+        return -1;
+    }
+    if (from == to) {
+        return 0;
+    }
+
+    double minutes;
+    if (lookupLocked(from, to, minutes)) {
+        cacheHits++;
+        return minutes;
+    }
+
+    cacheMisses++;
+    minutes = computeMinutes(from, to);
+    storeLocked(from, to, minutes);
+    return minutes;
+}
+
+std::vector<double> TravelTimeService::getTravelMinutesBatch(LocationId from,
+                                                             const std::vector<LocationId>& destinations,
+                                                             bool useCache) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::vector<double> result(destinations.size(), -1);
+    if (from >= versions.size() || versions[from] == 0) {
+        return result;
+    }
+
+    // Gather the misses into contiguous arrays for the kernel
+    std::vector<size_t> missIndex;
+    std::vector<double> dSinLat, dCosLat, dSinLon, dCosLon;
+    for (size_t i = 0; i < destinations.size(); ++i) {
+        LocationId to = destinations[i];
+        if (to >= versions.size() || versions[to] == 0) {
+            continue;
+        }
+        if (to == from) {
+            result[i] = 0;
+            continue;
+        }
+        if (useCache) {
+            if (lookupLocked(from, to, result[i])) {
+                cacheHits++;
+                continue;
+            }
+            cacheMisses++;
+        }
+
+        missIndex.push_back(i);
+        dSinLat.push_back(sinLat[to]);
+        dCosLat.push_back(cosLat[to]);
+        dSinLon.push_back(sinLon[to]);
+        dCosLon.push_back(cosLon[to]);
+    }
+
+    // Multiply-add only, so this loop vectorizes
+    size_t count = missIndex.size();
+    std::vector<double> haversine(count);
+    const double fromSinLat = sinLat[from], fromCosLat = cosLat[from];
+    const double fromSinLon = sinLon[from], fromCosLon = cosLon[from];
+    for (size_t i = 0; i < count; ++i) {
+        double cosDLat = fromCosLat * dCosLat[i] + fromSinLat * dSinLat[i];
+        double cosDLon = fromCosLon * dCosLon[i] + fromSinLon * dSinLon[i];
+        haversine[i] = (1 - cosDLat) * 0.5 + fromCosLat * dCosLat[i] * (1 - cosDLon) * 0.5;
+    }
+
+    const double minutesPerRadian = 2 * GeoUtils::EARTH_RADIUS_KM * roadFactor / averageSpeedKmh * 60;
+    for (size_t i = 0; i < count; ++i) {
+        double a = std::min(1.0, std::max(0.0, haversine[i]));
+        double minutes = minutesPerRadian * std::asin(std::sqrt(a));
+        result[missIndex[i]] = minutes;
+        if (useCache) {
+            storeLocked(from, destinations[missIndex[i]], minutes);
+        }
+    }
+
+    return result;
+}
+
+void TravelTimeService::setTravelModel(double roadFactor, double averageSpeedKmh) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    this->roadFactor = roadFactor;
+    this->averageSpeedKmh = averageSpeedKmh;
+    lruList.clear();
+    cacheIndex.clear();
+}
+
+size_t TravelTimeService::getLocationCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return locationNames.size();
+}
+
+size_t TravelTimeService::getCacheStats(size_t& hits, size_t& misses) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    hits = cacheHits;
+    misses = cacheMisses;
+    return cacheIndex.size();
+}
@@ -40,12 +40,7 @@ bool AuthenticationSystem::addUser(const std::string& username, const std::strin
 }
 
 bool AuthenticationSystem::authenticate(const std::string& username, const std::string& password) {
-    auto it = users.find(username);
-    if (it == users.end()) {
-        return false;
-    }
-
-    if (it->second.passwordHash == hashPassword(password)) {
+    if (checkCredentials(username, password)) {
         currentUser = username;
         return true;
     }
@@ -53,6 +48,11 @@ bool AuthenticationSystem::authenticate(const std::string& username, const std::
     return false;
 }
 
+bool AuthenticationSystem::checkCredentials(const std::string& username, const std::string& password) const {
+    auto it = users.find(username);
+    return it != users.end() && it->second.passwordHash == hashPassword(password);
+}
+
 void AuthenticationSystem::logout() {
     currentUser = "";
 }
@@ -5,11 +5,15 @@
 #include "CLI/CLI.h"
 #include <iostream>
 #include <sstream>
+#include <fstream>
 #include <iomanip>
 #include <algorithm>
 #include <cctype>
 
-CLI::CLI() : running(false), currentUser("") {
+CLI::CLI()
+    : accessPolicy(std::make_shared<const AccessPolicy>(AccessPolicy::createDefault())),
+      running(false),
+      currentUser("") {
     initializeCommands();
 }
 
@@ -35,7 +39,7 @@ void CLI::initializeCommands() {
     commandHelp["view"] = "View intervention details: view <id>";
 
     commandHandlers["create"] = [this](const auto& args) { handleCreateIntervention(args); };
-    commandHelp["create"] = "Create a new intervention: create <type> <location> <date> <duration>";
+    commandHelp["create"] = "Create a new intervention: create <type> <location> <date> <duration> [priority] [specialty]";
 
     commandHandlers["modify"] = [this](const auto& args) { handleModifyIntervention(args); };
     commandHelp["modify"] = "Modify an intervention: modify <id> <field> <value>";
@@ -49,6 +53,15 @@ void CLI::initializeCommands() {
     commandHandlers["status"] = [this](const auto& args) { handleChangeStatus(args); };
     commandHelp["status"] = "Change intervention status: status <id> <new_status> [comments]";
 
+    commandHandlers["dispatch"] = [this](const auto& args) { handleDispatch(args); };
+    commandHelp["dispatch"] = "Dispatch the most urgent emergency: dispatch [propose] [nopreempt]";
+
+    commandHandlers["travel"] = [this](const auto& args) { handleTravel(args); };
+    commandHelp["travel"] = "Travel time between two interventions: travel <from_id> <to_id> | travel load <gazetteer_file>";
+
+    commandHandlers["autoassign"] = [this](const auto& args) { handleAutoAssign(args); };
+    commandHelp["autoassign"] = "Assign technicians to all unassigned interventions: autoassign [greedy]";
+
     // Technician management
     commandHandlers["addtech"] = [this](const auto& args) { handleAddTechnician(args); };
     commandHelp["addtech"] = "Add a new technician: addtech <id> <name> <specialty> <contact>";
@@ -56,6 +69,12 @@ void CLI::initializeCommands() {
     commandHandlers["techs"] = [this](const auto& args) { handleListTechnicians(args); };
     commandHelp["techs"] = "List all technicians";
 
+    commandHandlers["shift"] = [this](const auto& args) { handleShift(args); };
+    commandHelp["shift"] = "Edit a technician's calendar: shift <technician_id> <work|oncall|holiday> <start_date> <end_date>";
+
+    commandHandlers["findslot"] = [this](const auto& args) { handleFindSlot(args); };
+    commandHelp["findslot"] = "Find the earliest free slots: findslot <duration> [specialty|any] [from_date] [count]";
+
     // Calendar
     commandHandlers["calendar"] = [this](const auto& args) { handleCalendar(args); };
     commandHelp["calendar"] = "Show calendar for a month: calendar <month> <year>";
@@ -76,6 +95,40 @@ void CLI::initializeCommands() {
 
     commandHandlers["addgpscoord"] = [this](const auto& args) { handleAddGPSCoordinate(args); };
     commandHelp["addgpscoord"] = "Add GPS coordinates to a decorated intervention: addgpscoord <id> <latitude> <longitude>";
+
+    commandHandlers["gpsimport"] = [this](const auto& args) { handleImportGPS(args); };
+    commandHelp["gpsimport"] = "Import GPS fixes from a file of 'id;latitude;longitude[;timestamp]' lines: gpsimport <file>";
+
+    commandHandlers["track"] = [this](const auto& args) { handleTrackSummary(args); };
+    commandHelp["track"] = "Show GPS track analytics of a decorated intervention: track <id> [site_radius_km]";
+
+    commandHandlers["trackpoints"] = [this](const auto& args) { handleTrackPoints(args); };
+    commandHelp["trackpoints"] = "List GPS points of a decorated intervention within a budget: trackpoints <id> [budget]";
+
+    commandHandlers["site"] = [this](const auto& args) { handleSite(args); };
+    commandHelp["site"] = "Set the coordinates of an intervention site: site <id> <latitude> <longitude>";
+
+    commandHandlers["nearby"] = [this](const auto& args) { handleNearby(args); };
+    commandHelp["nearby"] = "List sites within a radius and the nearest technicians: nearby <latitude> <longitude> [radius_km] [count]";
+
+    commandHandlers["geofence"] = [this](const auto& args) { handleGeofence(args); };
+    commandHelp["geofence"] = "Set a site's geofence radius or the automatic status changes: geofence <id> <radius_m> | geofence auto <off|arrival|both>";
+
+    commandHandlers["recur"] = [this](const auto& args) { handleRecur(args); };
+    commandHelp["recur"] = "Manage recurring interventions: recur <type> <location> <start_date> <duration> <rule> | "
+                           "recur show <series_id> <from_date> <to_date> | recur cancel <series_id> <index> | "
+                           "recur move <series_id> <index> <date> | recur delete <series_id> | recur horizon <days>";
+
+    commandHandlers["audit"] = [this](const auto& args) { handleAudit(args); };
+    commandHelp["audit"] = "Configure the access log: audit sample <N> (log one granted access in N, 0 for none) | audit flush";
+
+    commandHandlers["policy"] = [this](const auto& args) { handlePolicy(args); };
+    commandHelp["policy"] = "Access policy: policy show (your permissions) | policy load <file> (applies at next login)";
+
+    commandHandlers["notify"] = [this](const auto& args) { handleNotify(args); };
+    commandHelp["notify"] = "Notification delivery: notify stats | notify stub <on [session_us] [message_us]|off> | "
+                            "notify batch <window_ms> <max_size> | notify coalesce <window_ms> | "
+                            "notify channels <user_id> <console,log,email,mobile> | notify digest <on [seconds]|off>";
 }
 
 void CLI::start() {
@@ -262,19 +315,9 @@ void CLI::handleLogin(const std::vector<std::string>& args) {
 
         std::cout << "Login successful. Welcome, " << currentUser << " (" << role << ")." << std::endl;
 
-        // Create secure manager with user's permissions
-        manager = std::make_unique<InterventionManagerSecure>(currentUser);
-
-        // Map user roles to access levels
-        if (role == "admin") {
-            manager->setUserAccessLevel(currentUser, InterventionManagerSecure::AccessLevel::FULL);
-        } else if (role == "manager") {
-            manager->setUserAccessLevel(currentUser, InterventionManagerSecure::AccessLevel::MODIFY);
-        } else if (role == "technician") {
-            manager->setUserAccessLevel(currentUser, InterventionManagerSecure::AccessLevel::READ);
-        } else {
-            manager->setUserAccessLevel(currentUser, InterventionManagerSecure::AccessLevel::READ);
-        }
+        // Create secure manager with user's permissions: the policy's binding
+        // for the user if any, else the policy's role of the same name
+        manager = std::make_unique<InterventionManagerSecure>(currentUser, accessPolicy, role);
     } else {
         std::cout << "Login failed. Invalid username or password." << std::endl;
     }
@@ -330,21 +373,34 @@ void CLI::handleListInterventions(const std::vector<std::string>& args) {
 
     std::cout << std::string(85, '-') << std::endl;
 
+    bool hasPending = false;
     for (const auto* intervention : interventions) {
         char timeBuffer[10];
         std::time_t date = intervention->getDate();
         std::strftime(timeBuffer, sizeof(timeBuffer), "%H:%M", std::localtime(&date));
 
-        std::cout << std::left
-                  << std::setw(4) << intervention->getId()
-                  << std::setw(15) << intervention->getType()
-                  << std::setw(20) << intervention->getLocation()
+        // Occurrences of recurring series not created yet have no ID
+        std::cout << std::left << std::setw(4);
+        if (intervention->getId() > 0) {
+            std::cout << intervention->getId();
+        } else {
+            std::cout << "-";
+            hasPending = true;
+        }
+
+        // Views avoid copying each field; the flush happens once after the loop
+        std::cout << std::setw(15) << intervention->getTypeView()
+                  << std::setw(20) << intervention->getLocationView()
                   << std::setw(15) << timeBuffer
                   << std::setw(10) << intervention->getDuration()
-                  << std::setw(15) << intervention->getTechnicianId()
-                  << std::setw(15) << intervention->getStatus()
-                  << std::endl;
+                  << std::setw(15) << intervention->getTechnicianIdView()
+                  << std::setw(15) << intervention->getStatusView()
+                  << '\n';
+    }
+    if (hasPending) {
+        std::cout << "(-: recurring occurrence, created when it comes within the recurrence horizon)" << '\n';
     }
+    std::cout.flush();
 }
 
 void CLI::handleViewIntervention(const std::vector<std::string>& args) {
@@ -360,15 +416,15 @@ void CLI::handleViewIntervention(const std::vector<std::string>& args) {
 
     try {
         int id = std::stoi(args[0]);
-        const Intervention* intervention = manager->getIntervention(id);
+        std::string info = manager->getInterventionInfo(id);
 
-        if (!intervention) {
+        if (info.empty()) {
             std::cout << "Intervention not found." << std::endl;
             return;
         }
 
-        // Afficher directement les informations retournées par getInfo()
-        std::cout << intervention->getInfo() << std::endl;
+        // Details of the intervention and of its capabilities
+        std::cout << info << std::endl;
     } catch (const std::exception& e) {
         std::cout << "Invalid intervention ID." << std::endl;
     }
@@ -386,7 +442,7 @@ void CLI::handleCreateIntervention(const std::vector<std::string>& args) {
     }
 
     if (args.size() < 4) {
-        std::cout << "Usage: create <type> <location> <date> <duration>" << std::endl;
+        std::cout << "Usage: create <type> <location> <date> <duration> [priority] [specialty]" << std::endl;
         std::cout << "Example: create Maintenance \"Office Building A\" \"2025-06-15 14:30\" 120" << std::endl;
         return;
     }
@@ -413,7 +469,22 @@ void CLI::handleCreateIntervention(const std::vector<std::string>& args) {
         return;
     }
 
-    int id = manager->createIntervention(type, location, date, duration);
+    int id;
+    if (type == "Emergency" && args.size() > 4) {
+        // Emergency with explicit priority and optional required specialty
+        int priority;
+        try {
+            priority = std::stoi(args[4]);
+        } catch (const std::exception& e) {
+            std::cout << "Invalid priority." << std::endl;
+            return;
+        }
+
+        std::string specialty = args.size() > 5 ? args[5] : "";
+        id = manager->createEmergencyIntervention(location, date, duration, priority, specialty);
+    } else {
+        id = manager->createIntervention(type, location, date, duration);
+    }
 
     if (id != -1) {
         std::cout << "Intervention created with ID: " << id << std::endl;
@@ -577,6 +648,120 @@ void CLI::handleAssignTechnician(const std::vector<std::string>& args) {
     }
 }
 
+void CLI::handleDispatch(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (!authSystem.currentUserHasRole("admin") && !authSystem.currentUserHasRole("manager")) {
+        std::cout << "Permission denied. Only admins and managers can dispatch emergencies." << std::endl;
+        return;
+    }
+
+    bool proposeOnly = std::find(args.begin(), args.end(), "propose") != args.end();
+    bool allowPreemption = std::find(args.begin(), args.end(), "nopreempt") == args.end();
+
+    auto proposal = manager->proposeDispatch(allowPreemption);
+
+    if (proposal.interventionId == -1) {
+        std::cout << "No emergency waiting for dispatch." << std::endl;
+        return;
+    }
+
+    if (proposal.technicianId.empty()) {
+        std::cout << "No technician available for emergency #" << proposal.interventionId << "." << std::endl;
+        return;
+    }
+
+    std::cout << "Emergency #" << proposal.interventionId << " -> " << proposal.technicianId;
+    if (proposal.travelMinutes >= 0) {
+        std::cout << " (" << std::fixed << std::setprecision(0) << proposal.travelMinutes << " min away)";
+    }
+    std::cout << std::endl;
+
+    for (int bumpedId : proposal.preempted) {
+        std::cout << "  Preempts maintenance #" << bumpedId << std::endl;
+    }
+
+    if (proposeOnly) {
+        return;
+    }
+
+    if (manager->dispatchNextEmergency(allowPreemption)) {
+        std::cout << "Emergency dispatched. " << manager->getDispatchQueueSize()
+                  << " emergency(ies) still waiting." << std::endl;
+    } else {
+        std::cout << "Failed to dispatch emergency." << std::endl;
+    }
+}
+
+void CLI::handleTravel(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (args.size() < 2) {
+        std::cout << "Usage: travel <from_id> <to_id> | travel load <gazetteer_file>" << std::endl;
+        return;
+    }
+
+    if (args[0] == "load") {
+        int loaded = manager->loadGazetteer(args[1]);
+        if (loaded < 0) {
+            std::cout << "Failed to load gazetteer file. Check the file and your permissions." << std::endl;
+        } else {
+            std::cout << loaded << " location(s) loaded." << std::endl;
+        }
+        return;
+    }
+
+    int fromId, toId;
+    try {
+        fromId = std::stoi(args[0]);
+        toId = std::stoi(args[1]);
+    } catch (const std::exception& e) {
+        std::cout << "Invalid intervention ID." << std::endl;
+        return;
+    }
+
+    // Locations seen on GPS tracks can be used as well, by the users allowed to resolve them
+    const CapabilityToken& token = manager->getToken();
+    if (token.allows(CapabilityToken::Operation::LOAD_LOCATIONS) &&
+        !token.isScoped(CapabilityToken::Operation::LOAD_LOCATIONS)) {
+        manager->resolveLocationsFromTracking();
+    }
+
+    double minutes = manager->getTravelMinutes(fromId, toId);
+    if (minutes < 0) {
+        std::cout << "Unknown intervention or unresolved location." << std::endl;
+        return;
+    }
+
+    std::cout << "Travel time: " << std::fixed << std::setprecision(0) << minutes << " minute(s)." << std::endl;
+}
+
+void CLI::handleAutoAssign(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (!authSystem.currentUserHasRole("admin") && !authSystem.currentUserHasRole("manager")) {
+        std::cout << "Permission denied. Only admins and managers can assign technicians." << std::endl;
+        return;
+    }
+
+    bool greedy = !args.empty() && args[0] == "greedy";
+
+    auto report = manager->autoAssignTechnicians(greedy);
+
+    std::cout << "Assigned " << report.assigned << " of " << report.considered
+              << " unassigned intervention(s) in " << report.rounds << " round(s)";
+    std::cout << ", total travel " << std::fixed << std::setprecision(0) << report.totalTravelMinutes << " min." << std::endl;
+}
+
 void CLI::handleChangeStatus(const std::vector<std::string>& args) {
     if (currentUser.empty()) {
         std::cout << "Please login first." << std::endl;
@@ -697,6 +882,112 @@ void CLI::handleListTechnicians([[maybe_unused]] const std::vector<std::string>&
     }
 }
 
+void CLI::handleShift(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (!authSystem.currentUserHasRole("admin") && !authSystem.currentUserHasRole("manager")) {
+        std::cout << "Permission denied. Only admins and managers can edit shift calendars." << std::endl;
+        return;
+    }
+
+    if (args.size() < 4) {
+        std::cout << "Usage: shift <technician_id> <work|oncall|holiday> <start_date> <end_date>" << std::endl;
+        std::cout << "Example: shift T001 work \"2025-06-16 08:00\" \"2025-06-16 17:00\"" << std::endl;
+        return;
+    }
+
+    std::time_t start = parseDateTime(args[2]);
+    std::time_t end = parseDateTime(args[3]);
+    if (start == 0 || end == 0 || end <= start) {
+        std::cout << "Invalid period. Use YYYY-MM-DD HH:MM and an end after the start." << std::endl;
+        return;
+    }
+
+    ShiftCalendar::EntryKind kind;
+    if (args[1] == "work") {
+        kind = ShiftCalendar::EntryKind::SHIFT;
+    } else if (args[1] == "oncall") {
+        kind = ShiftCalendar::EntryKind::ON_CALL;
+    } else if (args[1] == "holiday") {
+        kind = ShiftCalendar::EntryKind::HOLIDAY;
+    } else {
+        std::cout << "Unknown entry type. Use work, oncall or holiday." << std::endl;
+        return;
+    }
+
+    if (!manager->addShiftEntry(args[0], kind, start, end)) {
+        std::cout << "Failed to update the calendar. Make sure the technician exists." << std::endl;
+        return;
+    }
+
+    std::cout << "Calendar updated. " << args[0] << " works "
+              << manager->getAvailableMinutes(args[0], start, end) / 60.0 << " hour(s) in this period." << std::endl;
+}
+
+void CLI::handleFindSlot(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (args.empty()) {
+        std::cout << "Usage: findslot <duration> [specialty|any] [from_date] [count]" << std::endl;
+        std::cout << "Example: findslot 90 Electrical \"2025-06-15 08:00\" 3" << std::endl;
+        return;
+    }
+
+    int duration;
+    try {
+        duration = std::stoi(args[0]);
+    } catch (const std::exception& e) {
+        std::cout << "Invalid duration." << std::endl;
+        return;
+    }
+
+    if (duration <= 0) {
+        std::cout << "Duration must be positive." << std::endl;
+        return;
+    }
+
+    std::string specialty = args.size() > 1 && args[1] != "any" ? args[1] : "";
+
+    std::time_t notBefore = std::time(nullptr);
+    if (args.size() > 2) {
+        notBefore = parseDateTime(args[2]);
+        if (notBefore == 0) {
+            std::cout << "Invalid date format. Use YYYY-MM-DD HH:MM." << std::endl;
+            return;
+        }
+    }
+
+    size_t count = 1;
+    if (args.size() > 3) {
+        try {
+            count = static_cast<size_t>(std::max(1, std::stoi(args[3])));
+        } catch (const std::exception& e) {
+            std::cout << "Invalid count." << std::endl;
+            return;
+        }
+    }
+
+    // Look up to four weeks ahead
+    const std::time_t HORIZON = 28 * 24 * 3600;
+
+    auto options = manager->findEarliestSlots(duration, specialty, notBefore, notBefore + HORIZON, count);
+
+    if (options.empty()) {
+        std::cout << "No free slot found in the next four weeks." << std::endl;
+        return;
+    }
+
+    for (const auto& option : options) {
+        std::cout << formatDateTime(option.start) << "  " << option.technicianId << std::endl;
+    }
+}
+
 void CLI::handleCalendar(const std::vector<std::string>& args) {
     if (currentUser.empty()) {
         std::cout << "Please login first." << std::endl;
@@ -985,4 +1276,741 @@ void CLI::handleAddGPSCoordinate(const std::vector<std::string>& args) {
     } else {
         std::cout << "Failed to add GPS coordinate. Make sure the intervention exists and has the GPS decorator." << std::endl;
     }
-}
\ No newline at end of file
+}
+
+void CLI::handleImportGPS(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (!authSystem.currentUserHasRole("admin") &&
+        !authSystem.currentUserHasRole("manager") &&
+        !authSystem.currentUserHasRole("technician")) {
+        std::cout << "Permission denied. Only admins, managers, and technicians can add GPS coordinates." << std::endl;
+        return;
+    }
+
+    if (args.empty()) {
+        std::cout << "Usage: gpsimport <file>" << std::endl;
+        return;
+    }
+
+    std::ifstream file(args[0]);
+    if (!file.is_open()) {
+        std::cout << "Cannot open " << args[0] << "." << std::endl;
+        return;
+    }
+
+    // Fixes are sent in batches so the manager groups them per intervention
+    const size_t BATCH_SIZE = 10000;
+    std::vector<GPSSample> batch;
+    batch.reserve(BATCH_SIZE);
+    size_t read = 0;
+    size_t stored = 0;
+    size_t malformed = 0;
+    std::time_t now = std::time(nullptr);
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        std::string id, latitude, longitude, timestamp;
+        if (!std::getline(fields, id, ';') || !std::getline(fields, latitude, ';') ||
+            !std::getline(fields, longitude, ';')) {
+            malformed++;
+            continue;
+        }
+        std::getline(fields, timestamp, ';');
+
+        try {
+            GPSSample sample;
+            sample.interventionId = std::stoi(id);
+            sample.latitude = std::stod(latitude);
+            sample.longitude = std::stod(longitude);
+            sample.timestamp = timestamp.empty() ? now : static_cast<std::time_t>(std::stoll(timestamp));
+            batch.push_back(sample);
+        } catch (const std::exception& e) {
+            malformed++;
+            continue;
+        }
+
+        read++;
+        if (batch.size() == BATCH_SIZE) {
+            stored += manager->addGPSCoordinates(batch);
+            batch.clear();
+        }
+    }
+    if (!batch.empty()) {
+        stored += manager->addGPSCoordinates(batch);
+    }
+
+    std::cout << stored << " of " << read << " GPS fix(es) stored";
+    if (malformed > 0) {
+        std::cout << ", " << malformed << " malformed line(s) skipped";
+    }
+    std::cout << "." << std::endl;
+}
+
+void CLI::handleTrackSummary(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (args.empty()) {
+        std::cout << "Usage: track <id> [site_radius_km]" << std::endl;
+        return;
+    }
+
+    int id;
+    double radiusKm = 0.1;
+    try {
+        id = std::stoi(args[0]);
+        if (args.size() > 1) {
+            radiusKm = std::stod(args[1]);
+        }
+    } catch (const std::exception& e) {
+        std::cout << "Invalid parameters. Please provide numeric values." << std::endl;
+        return;
+    }
+
+    TrackAnalytics::Summary summary;
+    if (!manager->getTrackSummary(id, summary, radiusKm)) {
+        std::cout << "Failed to read track. Make sure the intervention exists and has the GPS decorator." << std::endl;
+        return;
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Points: " << summary.points << std::endl;
+    std::cout << "Distance traveled: " << summary.totalDistanceKm << " km over "
+              << summary.durationSeconds / 60 << " minute(s)" << std::endl;
+    std::cout << "Speed: " << summary.averageSpeedKmh << " km/h average, "
+              << summary.maxSpeedKmh << " km/h max" << std::endl;
+
+    if (summary.hasSite) {
+        std::cout << "Distance to site: " << summary.distanceToSiteKm << " km (closest "
+                  << summary.closestApproachKm << " km)" << std::endl;
+        std::cout << "Time on site: " << summary.dwellSeconds / 60 << " minute(s)" << std::endl;
+    } else {
+        std::cout << "Site coordinates unknown." << std::endl;
+    }
+}
+
+void CLI::handleTrackPoints(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (args.empty()) {
+        std::cout << "Usage: trackpoints <id> [budget]" << std::endl;
+        return;
+    }
+
+    int id;
+    int budget = 50;
+    try {
+        id = std::stoi(args[0]);
+        if (args.size() > 1) {
+            budget = std::stoi(args[1]);
+        }
+    } catch (const std::exception& e) {
+        std::cout << "Invalid parameters. Please provide numeric values." << std::endl;
+        return;
+    }
+
+    if (budget <= 0) {
+        std::cout << "Budget must be positive." << std::endl;
+        return;
+    }
+
+    std::vector<GPSTrackingComponent::GPSCoordinate> points;
+    if (!manager->getTrackPoints(id, static_cast<size_t>(budget), points)) {
+        std::cout << "Failed to read track. Make sure the intervention exists and has the GPS decorator." << std::endl;
+        return;
+    }
+
+    std::cout << std::fixed << std::setprecision(6);
+    for (const auto& point : points) {
+        std::cout << formatDateTime(point.timestamp) << "  " << point.latitude << ", " << point.longitude << std::endl;
+    }
+    std::cout << points.size() << " point(s)." << std::endl;
+}
+
+void CLI::handleSite(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (args.size() < 3) {
+        std::cout << "Usage: site <id> <latitude> <longitude>" << std::endl;
+        return;
+    }
+
+    int id;
+    double latitude, longitude;
+    try {
+        id = std::stoi(args[0]);
+        latitude = std::stod(args[1]);
+        longitude = std::stod(args[2]);
+    } catch (const std::exception& e) {
+        std::cout << "Invalid parameters. Please provide numeric values." << std::endl;
+        return;
+    }
+
+    if (latitude < -90 || latitude > 90 || longitude < -180 || longitude > 180) {
+        std::cout << "Coordinates out of range." << std::endl;
+        return;
+    }
+
+    if (manager->setSiteCoordinates(id, latitude, longitude)) {
+        std::cout << "Site coordinates of intervention " << id << " set." << std::endl;
+    } else {
+        std::cout << "Failed to set the site of intervention " << id << ". Make sure it exists and you may modify it." << std::endl;
+    }
+}
+
+void CLI::handleNearby(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (args.size() < 2) {
+        std::cout << "Usage: nearby <latitude> <longitude> [radius_km] [count]" << std::endl;
+        return;
+    }
+
+    double latitude, longitude;
+    double radiusKm = 5.0;
+    int count = 3;
+    try {
+        latitude = std::stod(args[0]);
+        longitude = std::stod(args[1]);
+        if (args.size() > 2) {
+            radiusKm = std::stod(args[2]);
+        }
+        if (args.size() > 3) {
+            count = std::stoi(args[3]);
+        }
+    } catch (const std::exception& e) {
+        std::cout << "Invalid parameters. Please provide numeric values." << std::endl;
+        return;
+    }
+
+    if (radiusKm < 0 || count < 0) {
+        std::cout << "Radius and count must not be negative." << std::endl;
+        return;
+    }
+
+    auto sites = manager->findInterventionsWithin(latitude, longitude, radiusKm);
+    auto technicians = manager->findNearestTechnicians(latitude, longitude, static_cast<size_t>(count));
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Interventions within " << radiusKm << " km:" << std::endl;
+    for (const auto& site : sites) {
+        std::cout << "  #" << site.first << "  " << site.second << " km" << std::endl;
+    }
+    if (sites.empty()) {
+        std::cout << "  none" << std::endl;
+    }
+
+    std::cout << "Nearest technicians:" << std::endl;
+    for (const auto& technician : technicians) {
+        std::cout << "  " << technician.first << "  " << technician.second << " km" << std::endl;
+    }
+    if (technicians.empty()) {
+        std::cout << "  none" << std::endl;
+    }
+}
+
+void CLI::handleGeofence(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (args.size() < 2) {
+        std::cout << "Usage: geofence <id> <radius_m> | geofence auto <off|arrival|both>" << std::endl;
+        return;
+    }
+
+    if (args[0] == "auto") {
+        if (!authSystem.currentUserHasRole("admin") && !authSystem.currentUserHasRole("manager")) {
+            std::cout << "Permission denied. Only admins and managers can change automatic status updates." << std::endl;
+            return;
+        }
+
+        if (args[1] != "off" && args[1] != "arrival" && args[1] != "both") {
+            std::cout << "Unknown mode. Use off, arrival or both." << std::endl;
+            return;
+        }
+        if (!manager->setGeofenceAutoStatus(args[1] != "off", args[1] == "both")) {
+            std::cout << "Permission denied. Automatic status updates apply to every region." << std::endl;
+            return;
+        }
+        std::cout << "Geofence status changes: " << args[1] << "." << std::endl;
+        return;
+    }
+
+    int id;
+    double radiusMeters;
+    try {
+        id = std::stoi(args[0]);
+        radiusMeters = std::stod(args[1]);
+    } catch (const std::exception& e) {
+        std::cout << "Invalid parameters. Please provide numeric values." << std::endl;
+        return;
+    }
+
+    if (manager->setGeofenceRadius(id, radiusMeters / 1000.0)) {
+        std::cout << "Geofence of intervention " << id << " set to " << radiusMeters << " m." << std::endl;
+    } else {
+        std::cout << "Failed to set geofence. Make sure the site has coordinates and the radius is between 0 and "
+                  << GeofenceEngine::MAX_RADIUS_KM * 1000 << " m." << std::endl;
+    }
+}
+
+void CLI::handleRecur(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (args.empty()) {
+        std::cout << "Usage: recur <type> <location> <start_date> <duration> <rule>" << std::endl;
+        std::cout << "       recur show <series_id> <from_date> <to_date>" << std::endl;
+        std::cout << "       recur cancel <series_id> <index> | recur move <series_id> <index> <date>" << std::endl;
+        std::cout << "       recur delete <series_id> | recur horizon <days>" << std::endl;
+        std::cout << "Example: recur Maintenance \"HVAC Site X\" \"2026-11-02 09:00\" 90 \"FREQ=MONTHLY;INTERVAL=3\"" << std::endl;
+        return;
+    }
+
+    const std::string& action = args[0];
+
+    if (action == "show") {
+        if (args.size() < 4) {
+            std::cout << "Usage: recur show <series_id> <from_date> <to_date>" << std::endl;
+            return;
+        }
+
+        int seriesId;
+        try {
+            seriesId = std::stoi(args[1]);
+        } catch (const std::exception& e) {
+            std::cout << "Invalid series ID." << std::endl;
+            return;
+        }
+
+        std::string info = manager->getRecurringSeriesInfo(seriesId);
+        if (info.empty()) {
+            std::cout << "Recurring series not found." << std::endl;
+            return;
+        }
+
+        std::time_t from = parseDateTime(args[2]);
+        std::time_t to = parseDateTime(args[3]);
+        if (from == 0 || to == 0) {
+            std::cout << "Invalid date format. Use YYYY-MM-DD [HH:MM]." << std::endl;
+            return;
+        }
+
+        std::cout << "Series " << seriesId << ": " << info << std::endl;
+
+        auto occurrences = manager->getPendingOccurrences(seriesId, from, to);
+        if (occurrences.empty()) {
+            std::cout << "No pending occurrences in this window." << std::endl;
+            return;
+        }
+        for (const auto& occurrence : occurrences) {
+            std::cout << "  #" << occurrence.index << "  " << formatDateTime(occurrence.date) << std::endl;
+        }
+        return;
+    }
+
+    if (!authSystem.currentUserHasRole("admin") && !authSystem.currentUserHasRole("manager")) {
+        std::cout << "Permission denied. Only admins and managers can manage recurring interventions." << std::endl;
+        return;
+    }
+
+    if (action == "cancel" || action == "move") {
+        if (args.size() < (action == "move" ? 4u : 3u)) {
+            std::cout << "Usage: recur cancel <series_id> <index> | recur move <series_id> <index> <date>" << std::endl;
+            return;
+        }
+
+        int seriesId;
+        int index;
+        try {
+            seriesId = std::stoi(args[1]);
+            index = std::stoi(args[2]);
+        } catch (const std::exception& e) {
+            std::cout << "Invalid parameters. Please provide numeric values." << std::endl;
+            return;
+        }
+
+        bool success;
+        if (action == "cancel") {
+            success = manager->cancelOccurrence(seriesId, index);
+        } else {
+            std::time_t date = parseDateTime(args[3]);
+            if (date == 0) {
+                std::cout << "Invalid date format. Use YYYY-MM-DD HH:MM." << std::endl;
+                return;
+            }
+            success = manager->moveOccurrence(seriesId, index, date);
+        }
+
+        if (success) {
+            std::cout << "Occurrence " << index << " of series " << seriesId
+                      << (action == "cancel" ? " cancelled." : " moved.") << std::endl;
+        } else {
+            std::cout << "Failed to update the occurrence. Check the series ID and the index." << std::endl;
+        }
+        return;
+    }
+
+    if (action == "delete" || action == "horizon") {
+        if (args.size() < 2) {
+            std::cout << "Usage: recur delete <series_id> | recur horizon <days>" << std::endl;
+            return;
+        }
+
+        int value;
+        try {
+            value = std::stoi(args[1]);
+        } catch (const std::exception& e) {
+            std::cout << "Invalid parameters. Please provide numeric values." << std::endl;
+            return;
+        }
+
+        if (action == "horizon") {
+            if (manager->setRecurrenceHorizon(value)) {
+                std::cout << "Recurring interventions are now created " << (value < 1 ? 1 : value)
+                          << " days ahead." << std::endl;
+            } else {
+                std::cout << "Permission denied. The horizon applies to every region." << std::endl;
+            }
+        } else if (manager->deleteRecurringSeries(value)) {
+            std::cout << "Recurring series " << value << " deleted. Interventions already created are kept." << std::endl;
+        } else {
+            std::cout << "Recurring series not found." << std::endl;
+        }
+        return;
+    }
+
+    if (args.size() < 5) {
+        std::cout << "Usage: recur <type> <location> <start_date> <duration> <rule>" << std::endl;
+        return;
+    }
+
+    std::time_t start = parseDateTime(args[2]);
+    if (start == 0) {
+        std::cout << "Invalid date format. Use YYYY-MM-DD HH:MM." << std::endl;
+        return;
+    }
+
+    int duration;
+    try {
+        duration = std::stoi(args[3]);
+    } catch (const std::exception& e) {
+        std::cout << "Invalid duration." << std::endl;
+        return;
+    }
+
+    RecurrenceRule rule;
+    if (!RecurrenceRule::parse(args[4], rule)) {
+        std::cout << "Invalid rule. Use FREQ=DAILY|WEEKLY|MONTHLY[;INTERVAL=n][;COUNT=n][;UNTIL=YYYY-MM-DD]." << std::endl;
+        return;
+    }
+
+    int seriesId = manager->createRecurringIntervention(action, args[1], start, duration, rule);
+    if (seriesId != -1) {
+        std::cout << "Recurring series created with ID: " << seriesId << " (" << rule.toString() << ")" << std::endl;
+    } else {
+        std::cout << "Failed to create recurring series." << std::endl;
+    }
+}
+
+void CLI::handleAudit(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (!authSystem.currentUserHasRole("admin")) {
+        std::cout << "Permission denied. Only admins can configure the access log." << std::endl;
+        return;
+    }
+
+    auto auditLog = manager->getAuditLog();
+
+    if (args.size() == 1 && args[0] == "flush") {
+        auditLog->flush();
+        std::cout << "Access log written." << std::endl;
+        return;
+    }
+
+    if (args.size() < 2 || args[0] != "sample") {
+        std::cout << "Usage: audit sample <N> | audit flush" << std::endl;
+        return;
+    }
+
+    int interval;
+    try {
+        interval = std::stoi(args[1]);
+    } catch (const std::exception& e) {
+        std::cout << "Invalid sampling interval." << std::endl;
+        return;
+    }
+
+    if (interval < 0) {
+        std::cout << "Sampling interval must be 0 or more." << std::endl;
+        return;
+    }
+
+    auditLog->setGrantSampling(static_cast<unsigned>(interval));
+    if (interval == 0) {
+        std::cout << "Granted accesses are no longer logged. Denials still are." << std::endl;
+    } else {
+        std::cout << "Logging one granted access in " << interval << ". Denials are always logged." << std::endl;
+    }
+}
+
+void CLI::handlePolicy(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (args.size() == 1 && args[0] == "show") {
+        std::cout << accessPolicy->describe(manager->getToken()) << std::endl;
+        return;
+    }
+
+    if (args.size() < 2 || args[0] != "load") {
+        std::cout << "Usage: policy show | policy load <file>" << std::endl;
+        std::cout << "File lines: role;<name>;<operation>[:own],...  region;<name>;<location>[;<location>...]" << std::endl;
+        std::cout << "            user;<username>;<role>[;<region>,...|*[;<technician_id>]]" << std::endl;
+        return;
+    }
+
+    if (!authSystem.currentUserHasRole("admin")) {
+        std::cout << "Permission denied. Only admins can load an access policy." << std::endl;
+        return;
+    }
+
+    // Loaded on top of the default policy, then shared read-only by the proxies
+    AccessPolicy policy = AccessPolicy::createDefault();
+    int loaded = policy.load(args[1]);
+    if (loaded < 0) {
+        std::cout << "Failed to open " << args[1] << "." << std::endl;
+        return;
+    }
+
+    accessPolicy = std::make_shared<const AccessPolicy>(std::move(policy));
+    std::cout << loaded << " policy entries loaded. They apply from the next login." << std::endl;
+}
+
+void CLI::handleNotify(const std::vector<std::string>& args) {
+    if (currentUser.empty()) {
+        std::cout << "Please login first." << std::endl;
+        return;
+    }
+
+    if (!authSystem.currentUserHasRole("admin")) {
+        std::cout << "Permission denied. Only admins can configure notifications." << std::endl;
+        return;
+    }
+
+    if (args.empty()) {
+        std::cout << "Usage: notify stats | notify stub <on [session_us] [message_us]|off>" << std::endl;
+        std::cout << "       notify batch <window_ms> <max_size> | notify coalesce <window_ms>" << std::endl;
+        std::cout << "       notify channels <user_id> <console,log,email,mobile>" << std::endl;
+        std::cout << "       notify digest <on [seconds]|off>" << std::endl;
+        return;
+    }
+
+    InterventionManager* realManager = manager->getRealManager();
+    if (realManager == nullptr) {
+        std::cout << "Failed to access the manager." << std::endl;
+        return;
+    }
+    auto notifications = realManager->getNotificationSystem();
+    const std::string& action = args[0];
+
+    if (action == "stats") {
+        notifications->flush();
+
+        const std::pair<NotificationSystem::Channel, const char*> channels[] = {
+            {NotificationSystem::Channel::CONSOLE, "console"},
+            {NotificationSystem::Channel::LOG, "log"},
+            {NotificationSystem::Channel::EMAIL, "email"},
+            {NotificationSystem::Channel::MOBILE, "mobile"}
+        };
+
+        std::cout << std::left << std::setw(10) << "Channel" << std::right << std::setw(10) << "Enqueued"
+                  << std::setw(11) << "Coalesced" << std::setw(11) << "Delivered" << std::setw(9) << "Batches"
+                  << std::endl;
+        for (const auto& channel : channels) {
+            NotificationSystem::ChannelStats stats = notifications->getChannelStats(channel.first);
+            std::cout << std::left << std::setw(10) << channel.second << std::right << std::setw(10) << stats.enqueued
+                      << std::setw(11) << stats.coalesced << std::setw(11) << stats.delivered
+                      << std::setw(9) << stats.batches << std::endl;
+        }
+
+        if (notificationStub) {
+            NotificationStubServer::Stats stats = notificationStub->getStats();
+            std::cout << "Stub server: " << stats.messages << " messages in " << stats.sessions << " sessions, "
+                      << std::fixed << std::setprecision(2)
+                      << (stats.sessions > 0 ? stats.totalLatencyMs / stats.sessions : 0.0) << " ms average, "
+                      << stats.maxLatencyMs << " ms max" << std::endl;
+        }
+        return;
+    }
+
+    if (action == "stub") {
+        if (args.size() >= 2 && args[1] == "off") {
+            notifications->setStubServer(nullptr);
+            notificationStub.reset();
+            std::cout << "Email and mobile notifications are simulated on the console." << std::endl;
+            return;
+        }
+
+        if (args.size() < 2 || args[1] != "on") {
+            std::cout << "Usage: notify stub <on [session_us] [message_us]|off>" << std::endl;
+            return;
+        }
+
+        long sessionMicros = 2000;
+        long messageMicros = 50;
+        try {
+            if (args.size() > 2) {
+                sessionMicros = std::stol(args[2]);
+            }
+            if (args.size() > 3) {
+                messageMicros = std::stol(args[3]);
+            }
+        } catch (const std::exception& e) {
+            std::cout << "Invalid latency." << std::endl;
+            return;
+        }
+
+        if (sessionMicros < 0 || messageMicros < 0) {
+            std::cout << "Latencies must be 0 or more." << std::endl;
+            return;
+        }
+
+        notificationStub = std::make_shared<NotificationStubServer>(std::chrono::microseconds(sessionMicros),
+                                                                    std::chrono::microseconds(messageMicros));
+        notifications->setStubServer(notificationStub);
+        std::cout << "Email and mobile notifications go to the stub server (" << sessionMicros
+                  << " us per session, " << messageMicros << " us per message)." << std::endl;
+        return;
+    }
+
+    if (action == "batch" || action == "coalesce") {
+        size_t expected = action == "batch" ? 3 : 2;
+        if (args.size() < expected) {
+            std::cout << (action == "batch" ? "Usage: notify batch <window_ms> <max_size>"
+                                            : "Usage: notify coalesce <window_ms>") << std::endl;
+            return;
+        }
+
+        long windowMs;
+        long maxSize = 0;
+        try {
+            windowMs = std::stol(args[1]);
+            if (action == "batch") {
+                maxSize = std::stol(args[2]);
+            }
+        } catch (const std::exception& e) {
+            std::cout << "Invalid number." << std::endl;
+            return;
+        }
+
+        if (windowMs < 0 || (action == "batch" && maxSize <= 0)) {
+            std::cout << "The window must be 0 or more and the batch size positive." << std::endl;
+            return;
+        }
+
+        if (action == "batch") {
+            notifications->setBatching(std::chrono::milliseconds(windowMs), static_cast<size_t>(maxSize));
+            std::cout << "Batches of up to " << maxSize << " notifications, waiting " << windowMs << " ms." << std::endl;
+        } else {
+            notifications->setCoalescingWindow(std::chrono::milliseconds(windowMs));
+            std::cout << (windowMs == 0 ? std::string("Duplicate notifications are no longer coalesced.")
+                                        : "Duplicates within " + std::to_string(windowMs) + " ms are coalesced.")
+                      << std::endl;
+        }
+        return;
+    }
+
+    if (action == "channels") {
+        if (args.size() < 3) {
+            std::cout << "Usage: notify channels <user_id> <console,log,email,mobile>" << std::endl;
+            return;
+        }
+
+        std::vector<NotificationSystem::Channel> channels;
+        std::istringstream list(args[2]);
+        std::string name;
+        while (std::getline(list, name, ',')) {
+            if (name == "console") {
+                channels.push_back(NotificationSystem::Channel::CONSOLE);
+            } else if (name == "log") {
+                channels.push_back(NotificationSystem::Channel::LOG);
+            } else if (name == "email") {
+                channels.push_back(NotificationSystem::Channel::EMAIL);
+            } else if (name == "mobile") {
+                channels.push_back(NotificationSystem::Channel::MOBILE);
+            } else {
+                std::cout << "Unknown channel: " << name << std::endl;
+                return;
+            }
+        }
+
+        notifications->setUserPreferences(args[1], channels);
+        std::cout << "Notifications for " << args[1] << " go to " << args[2] << "." << std::endl;
+        return;
+    }
+
+    if (action == "digest") {
+        if (args.size() >= 2 && args[1] == "off") {
+            realManager->setGeneralDigest(false);
+            std::cout << "General events are no longer broadcast." << std::endl;
+            return;
+        }
+
+        if (args.size() < 2 || args[1] != "on") {
+            std::cout << "Usage: notify digest <on [seconds]|off>" << std::endl;
+            return;
+        }
+
+        int seconds = 60;
+        try {
+            if (args.size() > 2) {
+                seconds = std::stoi(args[2]);
+            }
+        } catch (const std::exception& e) {
+            std::cout << "Invalid interval." << std::endl;
+            return;
+        }
+
+        if (seconds < 0) {
+            std::cout << "The interval must be 0 or more." << std::endl;
+            return;
+        }
+
+        realManager->setGeneralDigest(true, seconds);
+        std::cout << "General events are broadcast as a digest every " << seconds << " s." << std::endl;
+        return;
+    }
+
+    std::cout << "Unknown notify action: " << action << std::endl;
+}
@@ -2,16 +2,12 @@
 // Created by Léo KRYS on 21/04/2025.
 //
 
-#include "Decorator/AttachmentsDecorator.h"
+#include "Component/AttachmentsComponent.h"
 #include <sstream>
 #include <algorithm>
 #include <ctime>
 
-AttachmentsDecorator::AttachmentsDecorator(std::unique_ptr<Intervention> intervention)
-    : InterventionDecorator(std::move(intervention)) {
-}
-
-bool AttachmentsDecorator::addAttachment(const std::string& filename, const std::string& description) {
+bool AttachmentsComponent::addAttachment(const std::string& filename, const std::string& description) {
     // Check if the file is already attached
     if (hasAttachment(filename)) {
         return false;
@@ -22,7 +18,7 @@ bool AttachmentsDecorator::addAttachment(const std::string& filename, const std:
     return true;
 }
 
-bool AttachmentsDecorator::removeAttachment(const std::string& filename) {
+bool AttachmentsComponent::removeAttachment(const std::string& filename) {
     auto it = std::find_if(attachments.begin(), attachments.end(),
                           [&filename](const Attachment& attachment) {
                               return attachment.filename == filename;
@@ -36,7 +32,7 @@ bool AttachmentsDecorator::removeAttachment(const std::string& filename) {
     return true;
 }
 
-std::vector<std::string> AttachmentsDecorator::getAttachmentFilenames() const {
+std::vector<std::string> AttachmentsComponent::getAttachmentFilenames() const {
     std::vector<std::string> filenames;
     filenames.reserve(attachments.size());
 
@@ -47,23 +43,20 @@ std::vector<std::string> AttachmentsDecorator::getAttachmentFilenames() const {
     return filenames;
 }
 
-bool AttachmentsDecorator::hasAttachment(const std::string& filename) const {
+bool AttachmentsComponent::hasAttachment(const std::string& filename) const {
     return std::any_of(attachments.begin(), attachments.end(),
                       [&filename](const Attachment& attachment) {
                           return attachment.filename == filename;
                       });
 }
 
-size_t AttachmentsDecorator::getAttachmentCount() const {
+size_t AttachmentsComponent::getAttachmentCount() const {
     return attachments.size();
 }
 
-std::string AttachmentsDecorator::getInfo() const {
-    // Get the base info from the wrapped intervention
-    std::string baseInfo = InterventionDecorator::getInfo();
-
+std::string AttachmentsComponent::getInfo() const {
     std::ostringstream attachInfo;
-    attachInfo << baseInfo << std::endl << "Attachments: " << attachments.size();
+    attachInfo << "Attachments: " << attachments.size();
 
     // List all attachments if any
     if (!attachments.empty()) {
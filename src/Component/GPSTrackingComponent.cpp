@@ -0,0 +1,95 @@
+//
+// Created by Léo KRYS on 21/04/2025.
+//
+
+#include "Component/GPSTrackingComponent.h"
+#include <sstream>
+#include <iomanip>
+#include <ctime>
+
+GPSTrackingComponent::GPSTrackingComponent(int updateFrequency)
+    : updateFrequency(updateFrequency) {
+    // Validate frequency
+    if (this->updateFrequency < 1) this->updateFrequency = 1;
+}
+
+void GPSTrackingComponent::addCoordinate(double latitude, double longitude, std::time_t timestamp) {
+    trackingData.append(latitude, longitude, timestamp);
+    levelsOfDetail.add(trackingData.back());
+}
+
+std::pair<double, double> GPSTrackingComponent::getCurrentLocation() const {
+    if (trackingData.empty()) {
+        return {0.0, 0.0}; // No data available
+    }
+
+    // Return the most recent coordinate
+    GPSCoordinate latest = trackingData.back();
+    return {latest.latitude, latest.longitude};
+}
+
+void GPSTrackingComponent::setUpdateFrequency(int minutes) {
+    if (minutes < 1) minutes = 1;
+    updateFrequency = minutes;
+}
+
+int GPSTrackingComponent::getUpdateFrequency() const {
+    return updateFrequency;
+}
+
+std::vector<GPSTrackingComponent::GPSCoordinate> GPSTrackingComponent::getTrackingData() const {
+    return trackingData.decodeAll();
+}
+
+std::vector<GPSTrackingComponent::GPSCoordinate> GPSTrackingComponent::getTrackingData(std::time_t from,
+                                                                                      std::time_t to) const {
+    return trackingData.decodeRange(from, to);
+}
+
+std::vector<GPSTrackingComponent::GPSCoordinate> GPSTrackingComponent::getSimplifiedTrackingData(size_t budget) const {
+    // Decoding the whole track is O(budget) when it fits
+    if (trackingData.size() <= budget) {
+        return trackingData.decodeAll();
+    }
+    return levelsOfDetail.getWithBudget(budget);
+}
+
+void GPSTrackingComponent::setSimplificationTolerance(double meters) {
+    levelsOfDetail.clear();
+    levelsOfDetail.setTolerance(meters);
+    for (const auto& point : trackingData.decodeAll()) {
+        levelsOfDetail.add(point);
+    }
+}
+
+size_t GPSTrackingComponent::getTrackingPointCount() const {
+    return trackingData.size();
+}
+
+size_t GPSTrackingComponent::getTrackingMemoryUsage() const {
+    return trackingData.getMemoryUsage() + levelsOfDetail.getMemoryUsage();
+}
+
+std::string GPSTrackingComponent::getInfo() const {
+    std::ostringstream gpsInfo;
+    gpsInfo << "GPS Tracking: Enabled";
+    gpsInfo << " (Update frequency: " << updateFrequency << " minutes)";
+
+    if (!trackingData.empty()) {
+        GPSCoordinate latest = trackingData.back();
+
+        // Format the timestamp
+        char timeBuffer[25];
+        std::strftime(timeBuffer, sizeof(timeBuffer), "%m/%d/%Y %H:%M:%S",
+                     std::localtime(&latest.timestamp));
+
+        gpsInfo << std::endl << "Last position: "
+                << std::fixed << std::setprecision(6)
+                << latest.latitude << ", " << latest.longitude
+                << " (as of " << timeBuffer << ")";
+
+        gpsInfo << std::endl << "Total tracking points: " << trackingData.size();
+    }
+
+    return gpsInfo.str();
+}
\ No newline at end of file
@@ -6,12 +6,18 @@
 
 InterventionDecorator::InterventionDecorator(std::unique_ptr<Intervention> intervention)
     : intervention(std::move(intervention)) {
+    // The fields live in the wrapped intervention; views read them there
+    fieldOwner = &this->intervention->fields();
 }
 
 std::string InterventionDecorator::getType() const {
     return intervention->getType();
 }
 
+std::unique_ptr<Intervention> InterventionDecorator::clone() const {
+    return intervention->clone();
+}
+
 std::string InterventionDecorator::getInfo() const {
     return intervention->getInfo();
 }
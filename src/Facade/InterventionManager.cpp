@@ -5,27 +5,54 @@
 #include "Facade/InterventionManager.h"
 #include "Model/EmergencyIntervention.h"
 #include "Model/MaintenanceIntervention.h"
-#include "Decorator/GPSTrackingDecorator.h"
-#include "Decorator/AttachmentsDecorator.h"
+#include "Decorator/InterventionDecorator.h"
+#include "Business/AssignmentSolver.h"
+#include "Observer/TechnicianNotificationObserver.h"
 #include <iostream>
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
 
-#include "AttachmentsDecorator.h"
-#include "GPSTrackingDecorator.h"
-
 InterventionManager::InterventionManager()
-    : technicianManager(),
+    : factoryRegistry(InterventionFactoryRegistry::getInstance()),
+      technicianManager(),
       notificationSystem(std::make_shared<NotificationSystem>(true, true, "notifications.log")),
-      nextInterventionId(1) {
+      nextInterventionId(1),
+      scheduler(std::time(nullptr)),
+      reminderLeadMinutes(30),
+      escalationGraceMinutes(0),
+      snapshotTimer(TimerWheel::INVALID_TIMER),
+      snapshotIntervalMinutes(0),
+      defaultGeofenceRadiusKm(0.15),
+      geofenceStartOnArrival(false),
+      geofenceCompleteOnDeparture(false),
+      recurrenceHorizonDays(14),
+      recurrenceTimer(TimerWheel::INVALID_TIMER),
+      schedulerStopping(false) {
+    schedulerThread = std::thread(&InterventionManager::runScheduler, this);
+}
+
+InterventionManager::~InterventionManager() {
+    {
+        std::lock_guard<std::mutex> lock(schedulerWakeMutex);
+        schedulerStopping = true;
+    }
+    schedulerWake.notify_all();
+
+    if (schedulerThread.joinable()) {
+        schedulerThread.join();
+    }
 }
 
 void InterventionManager::addObserver(std::shared_ptr<InterventionObserver> observer) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     observers.push_back(observer);
 }
 
 void InterventionManager::removeObserver(InterventionObserver* observer) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     observers.erase(
         std::remove_if(observers.begin(), observers.end(),
             [observer](const std::shared_ptr<InterventionObserver>& ptr) {
@@ -34,10 +61,28 @@ void InterventionManager::removeObserver(InterventionObserver* observer) {
         observers.end());
 }
 
+void InterventionManager::setGeneralDigest(bool enabled, int intervalSeconds) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    if (generalDigest) {
+        removeObserver(generalDigest.get());
+        generalDigest.reset();
+    }
+
+    if (enabled) {
+        // Technicians are notified directly by the manager: the observer only digests the general events
+        generalDigest = std::make_shared<TechnicianNotificationObserver>(notificationSystem, intervalSeconds, false);
+        observers.push_back(generalDigest);
+    }
+}
+
 bool InterventionManager::addTechnician(const Technician& technician) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     bool result = technicianManager.addTechnician(technician);
 
     if (result) {
+        registerTechnicianGroups(technician);
         notifyObservers("technician_added",
                        "Technician " + technician.getId() + " (" + technician.getName() + ") added");
     }
@@ -45,19 +90,100 @@ bool InterventionManager::addTechnician(const Technician& technician) {
     return result;
 }
 
+void InterventionManager::registerTechnicianGroups(const Technician& technician) {
+    notificationSystem->addToGroup("technicians", technician.getId());
+    if (!technician.getSpecialty().empty()) {
+        notificationSystem->addToGroup("specialty:" + technician.getSpecialty(), technician.getId());
+    }
+}
+
+bool InterventionManager::addTechnicianToGroup(const std::string& technicianId, const std::string& group) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    if (technicianManager.getTechnician(technicianId) == nullptr) {
+        return false;
+    }
+
+    notificationSystem->addToGroup(group, technicianId);
+    return true;
+}
+
+int InterventionManager::notifyGroup(const std::string& group, const std::string& message) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    return notificationSystem->notifyGroup(group, message);
+}
+
 const std::map<std::string, Technician>& InterventionManager::getAllTechnicians() const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     return technicianManager.getAllTechnicians();
 }
 
 std::vector<std::string> InterventionManager::findAvailableTechnicians(
     std::time_t date, int duration, const std::string& specialty) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     return technicianManager.findAvailableTechnicians(date, duration, specialty);
 }
 
-void InterventionManager::notifyObservers(const std::string& eventType, const std::string& message) {
+std::vector<TechnicianManager::SlotOption> InterventionManager::findEarliestSlots(
+    int duration, const std::string& specialty, std::time_t notBefore, std::time_t horizon, size_t count) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    return technicianManager.findEarliestSlots(duration, specialty, notBefore, horizon, count);
+}
+
+ShiftCalendar* InterventionManager::getShiftCalendar(const std::string& technicianId) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    return technicianManager.getShiftCalendar(technicianId);
+}
+
+bool InterventionManager::addShiftEntry(const std::string& technicianId, ShiftCalendar::EntryKind kind,
+                                        std::time_t start, std::time_t end) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    ShiftCalendar* calendar = technicianManager.getShiftCalendar(technicianId);
+    if (calendar == nullptr || end <= start) {
+        return false;
+    }
+
+    switch (kind) {
+        case ShiftCalendar::EntryKind::SHIFT:
+            calendar->addShift(start, end);
+            break;
+        case ShiftCalendar::EntryKind::ON_CALL:
+            calendar->addOnCall(start, end);
+            break;
+        case ShiftCalendar::EntryKind::HOLIDAY:
+            calendar->addHoliday(start, end);
+            break;
+    }
+    return true;
+}
+
+int InterventionManager::getAvailableMinutes(const std::string& technicianId, std::time_t from, std::time_t to) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    if (technicianManager.getTechnician(technicianId) == nullptr) {
+        return -1;
+    }
+
+    const ShiftCalendar* calendar = technicianManager.findShiftCalendar(technicianId);
+    if (calendar == nullptr) {
+        return to > from ? static_cast<int>((to - from) / 60) : 0; // Works around the clock
+    }
+    return calendar->getAvailableMinutes(from, to);
+}
+
+void InterventionManager::notifyObservers(const std::string& eventType, const std::string& message,
+                                          int interventionId, const std::string& technicianId) {
+    InterventionEvent event(eventType, message, interventionId, technicianId);
+
     for (const auto& observer : observers) {
         if (observer->isInterestedIn(eventType)) {
-            observer->notify(message);
+            observer->notifyEvent(event);
         }
     }
 }
@@ -81,11 +207,11 @@ std::string InterventionManager::generateInterventionSummary(int interventionId)
 
     // Build summary
     std::ostringstream summary;
-    summary << "Intervention #" << interventionId << " (" << intervention->getType() << ")" << std::endl
-            << "  Location: " << intervention->getLocation() << std::endl
+    summary << "Intervention #" << interventionId << " (" << intervention->getTypeView() << ")" << std::endl
+            << "  Location: " << intervention->getLocationView() << std::endl
             << "  Date: " << dateBuffer << std::endl
             << "  Duration: " << intervention->getDuration() << " minutes" << std::endl
-            << "  Status: " << intervention->getStatus();
+            << "  Status: " << intervention->getStatusView();
 
     // Add technician info if assigned
     std::string techId = intervention->getTechnicianId();
@@ -109,6 +235,8 @@ std::string InterventionManager::generateInterventionSummary(int interventionId)
 }
 
 std::string InterventionManager::generateSystemSummary() const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     std::ostringstream summary;
 
     // Count interventions by type and status
@@ -147,34 +275,76 @@ int InterventionManager::createIntervention(const std::string& type,
                                          const std::string& location,
                                          std::time_t date,
                                          int duration) {
-    // Get the appropriate factory from the registry
-    auto& registry = InterventionFactoryRegistry::getInstance();
+    return createIntervention(factoryRegistry.resolveType(type), location, date, duration);
+}
+
+InterventionFactoryRegistry::TypeId InterventionManager::resolveInterventionType(const std::string& type) const {
+    return factoryRegistry.resolveType(type);
+}
+
+int InterventionManager::createIntervention(InterventionFactoryRegistry::TypeId typeId,
+                                         const std::string& location,
+                                         std::time_t date,
+                                         int duration) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
 
-    // Create the intervention
-    auto intervention = registry.createIntervention(type, location, date, duration);
+    // Create the intervention with the factory of the type
+    auto intervention = factoryRegistry.createIntervention(typeId, location, date, duration);
     if (!intervention) {
         return -1; // Factory returned nullptr (unknown type)
     }
 
+    return storeNewIntervention(std::move(intervention), factoryRegistry.getTypeName(typeId));
+}
+
+int InterventionManager::createEmergencyIntervention(const std::string& location,
+                                                  std::time_t date,
+                                                  int duration,
+                                                  int priority,
+                                                  const std::string& specialty) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    auto intervention = factoryRegistry.createIntervention(factoryRegistry.resolveType("Emergency"), location, date, duration);
+
+    EmergencyIntervention* emergency = dynamic_cast<EmergencyIntervention*>(intervention.get());
+    if (!emergency) {
+        return -1; // No emergency factory registered
+    }
+
+    emergency->setPriority(priority);
+    emergency->setRequiredSpecialty(specialty);
+
+    return storeNewIntervention(std::move(intervention), "Emergency");
+}
+
+int InterventionManager::storeNewIntervention(std::unique_ptr<Intervention> intervention, const std::string& type) {
     // Set the ID
     int id = nextInterventionId++;
     intervention->setId(id);
 
     // Schedule the intervention
-    if (!planner.scheduleIntervention(id, date, duration)) {
+    if (!planner.scheduleIntervention(id, intervention->getDate(), intervention->getDuration())) {
         return -1; // Scheduling failed
     }
 
+    // Emergencies wait in the dispatch queue until a technician is assigned
+    if (const auto* emergency = asEmergency(intervention.get())) {
+        dispatchQueue.push(id, emergency->getPriority(), emergency->getRequiredSpecialty());
+    }
+
     // Store the intervention
     interventions[id] = std::move(intervention);
+    armInterventionTimers(id);
 
     // Notify observers
-    notifyObservers("creation", "Intervention " + std::to_string(id) + " created (" + type + ")");
+    notifyObservers("creation", "Intervention " + std::to_string(id) + " created (" + type + ")", id);
 
     return id;
 }
 
 bool InterventionManager::deleteIntervention(int interventionId) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     // Check if the intervention exists
     auto it = interventions.find(interventionId);
     if (it == interventions.end()) {
@@ -200,9 +370,23 @@ bool InterventionManager::deleteIntervention(int interventionId) {
 
     // Remove from interventions map
     interventions.erase(it);
+    components.removeAll(interventionId);
+    cancelInterventionTimers(interventionId);
+    dispatchQueue.remove(interventionId);
+    siteCoordinates.erase(interventionId);
+    siteIndex.remove(interventionId);
+    geofences.removeFence(interventionId);
+
+    // A deleted occurrence must not be materialized again
+    auto occurrence = recurringOccurrences.find(interventionId);
+    if (occurrence != recurringOccurrences.end()) {
+        recurrences.cancelOccurrence(occurrence->second.first, occurrence->second.second);
+        recurringOccurrences.erase(occurrence);
+    }
 
     // Notify observers
-    notifyObservers("deletion", "Intervention " + std::to_string(interventionId) + " deleted (" + type + ")");
+    notifyObservers("deletion", "Intervention " + std::to_string(interventionId) + " deleted (" + type + ")",
+                    interventionId, techId);
 
     return true;
 }
@@ -211,6 +395,8 @@ bool InterventionManager::modifyIntervention(int interventionId,
                                           const std::string& location,
                                           std::time_t date,
                                           int duration) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     // Check if the intervention exists
     auto it = interventions.find(interventionId);
     if (it == interventions.end()) {
@@ -252,13 +438,18 @@ bool InterventionManager::modifyIntervention(int interventionId,
         // Update technician assignment if assigned
         std::string techId = it->second->getTechnicianId();
         if (!techId.empty()) {
+            bool emergency = asEmergency(it->second.get()) != nullptr;
             technicianManager.unassignTechnician(techId, oldDate);
-            technicianManager.assignTechnician(techId, newDate, newDuration);
+            technicianManager.assignTechnician(techId, newDate, newDuration, emergency);
         }
+
+        // Move the reminder and escalation with the new date
+        armInterventionTimers(interventionId);
     }
 
     // Notify observers
-    notifyObservers("modification", "Intervention " + std::to_string(interventionId) + " modified");
+    notifyObservers("modification", "Intervention " + std::to_string(interventionId) + " modified",
+                    interventionId, it->second->getTechnicianId());
 
     return true;
 }
@@ -266,6 +457,8 @@ bool InterventionManager::modifyIntervention(int interventionId,
 bool InterventionManager::changeInterventionStatus(int interventionId,
                                                 const std::string& status,
                                                 const std::string& comments) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     // Check if the intervention exists
     auto it = interventions.find(interventionId);
     if (it == interventions.end()) {
@@ -276,18 +469,28 @@ bool InterventionManager::changeInterventionStatus(int interventionId,
     std::string oldStatus = it->second->getStatus();
     it->second->setStatus(status);
 
+    // A closed emergency no longer waits for a technician; a reopened one waits again
+    if (status == "Completed" || status == "Cancelled") {
+        dispatchQueue.remove(interventionId);
+    } else if (it->second->getTechnicianId().empty()) {
+        if (const auto* emergency = asEmergency(it->second.get())) {
+            dispatchQueue.push(interventionId, emergency->getPriority(), emergency->getRequiredSpecialty());
+        }
+    }
+
     // Update comments if provided
     if (!comments.empty()) {
         it->second->setComments(comments);
     }
 
     // Notify observers
+    std::string techId = it->second->getTechnicianId();
     notifyObservers("status_change",
                    "Intervention " + std::to_string(interventionId) +
-                   " status changed from " + oldStatus + " to " + status);
+                   " status changed from " + oldStatus + " to " + status,
+                   interventionId, techId);
 
     // Notify technician if assigned
-    std::string techId = it->second->getTechnicianId();
     if (!techId.empty()) {
         notificationSystem->notifyTechnician(techId,
             "Status of intervention #" + std::to_string(interventionId) +
@@ -299,6 +502,8 @@ bool InterventionManager::changeInterventionStatus(int interventionId,
 
 bool InterventionManager::assignTechnician(int interventionId,
                                         const std::string& technicianId) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     // Check if the intervention exists
     auto it = interventions.find(interventionId);
     if (it == interventions.end()) {
@@ -310,10 +515,11 @@ bool InterventionManager::assignTechnician(int interventionId,
         return false;
     }
 
-    // Check if the technician is available
+    // Check if the technician is available (on-call windows count for emergencies)
     std::time_t date = it->second->getDate();
     int duration = it->second->getDuration();
-    if (!technicianManager.isTechnicianAvailable(technicianId, date, duration)) {
+    bool emergency = asEmergency(it->second.get()) != nullptr;
+    if (!technicianManager.isTechnicianAvailable(technicianId, date, duration, emergency)) {
         return false;
     }
 
@@ -328,17 +534,19 @@ bool InterventionManager::assignTechnician(int interventionId,
     }
 
     // Assign new technician
-    if (!technicianManager.assignTechnician(technicianId, date, duration)) {
+    if (!technicianManager.assignTechnician(technicianId, date, duration, emergency)) {
         return false;
     }
 
     // Update intervention
     it->second->setTechnicianId(technicianId);
+    dispatchQueue.remove(interventionId);
 
     // Notify observers
     notifyObservers("technician_assignment",
                    "Technician " + technicianId + " assigned to intervention " +
-                   std::to_string(interventionId));
+                   std::to_string(interventionId),
+                   interventionId, technicianId);
 
     // Notify technician
     notificationSystem->notifyTechnician(technicianId,
@@ -349,6 +557,8 @@ bool InterventionManager::assignTechnician(int interventionId,
 }
 
 const Intervention* InterventionManager::getIntervention(int interventionId) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     auto it = interventions.find(interventionId);
     if (it != interventions.end()) {
         return it->second.get();
@@ -356,7 +566,28 @@ const Intervention* InterventionManager::getIntervention(int interventionId) con
     return nullptr;
 }
 
+std::string InterventionManager::getInterventionInfo(int interventionId) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    auto it = interventions.find(interventionId);
+    if (it == interventions.end()) {
+        return "";
+    }
+
+    // The intervention's own details, then one section per capability
+    std::string info = it->second->getInfo();
+    if (const auto* tracking = components.get<GPSTrackingComponent>(interventionId)) {
+        info += "\n" + tracking->getInfo();
+    }
+    if (const auto* attachments = components.get<AttachmentsComponent>(interventionId)) {
+        info += "\n" + attachments->getInfo();
+    }
+    return info;
+}
+
 std::vector<const Intervention*> InterventionManager::getInterventionsForDay(std::time_t date) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     std::vector<const Intervention*> result;
 
     // Get intervention IDs for the day
@@ -370,14 +601,55 @@ std::vector<const Intervention*> InterventionManager::getInterventionsForDay(std
         }
     }
 
+    // Add the occurrences of recurring series not created yet, expanded for this day only
+    if (recurrences.getSeriesCount() > 0) {
+        std::tm day = *std::localtime(&date);
+        day.tm_hour = 0;
+        day.tm_min = 0;
+        day.tm_sec = 0;
+        day.tm_isdst = -1;
+        std::time_t dayStart = std::mktime(&day);
+        day.tm_mday += 1;
+        day.tm_isdst = -1;
+        std::time_t dayEnd = std::mktime(&day);
+
+        for (const Intervention* occurrence : recurrenceCache.getInstances(recurrences, dayStart, dayEnd)) {
+            result.push_back(occurrence);
+        }
+    }
+
     return result;
 }
 
 std::map<int, int> InterventionManager::getInterventionCountsForMonth(int month, int year) const {
-    return planner.countInterventionsPerDay(month, year);
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    std::map<int, int> counts = planner.countInterventionsPerDay(month, year);
+    if (recurrences.getSeriesCount() == 0 || counts.empty()) {
+        return counts;
+    }
+
+    // Add the occurrences of recurring series not created yet, expanded for this month only
+    std::tm bound = {};
+    bound.tm_year = year - 1900;
+    bound.tm_mon = month - 1;
+    bound.tm_mday = 1;
+    bound.tm_isdst = -1;
+    std::time_t monthStart = std::mktime(&bound);
+    bound.tm_mon += 1;
+    bound.tm_isdst = -1;
+    std::time_t monthEnd = std::mktime(&bound);
+
+    for (const auto& pair : recurrenceCache.getDayCounts(recurrences, monthStart, monthEnd)) {
+        counts[pair.first] += pair.second;
+    }
+
+    return counts;
 }
 
 bool InterventionManager::initializeWithSampleData() {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     // Create some sample interventions
     std::time_t now = std::time(nullptr);
 
@@ -389,9 +661,16 @@ bool InterventionManager::initializeWithSampleData() {
     createIntervention("Maintenance", "Retail Store C", tomorrow, 90);
 
     // Create some sample technicians
-    technicianManager.addTechnician(Technician("TECH001", "John Smith", "Electrical", "john@example.com"));
-    technicianManager.addTechnician(Technician("TECH002", "Jane Doe", "Plumbing", "jane@example.com"));
-    technicianManager.addTechnician(Technician("TECH003", "Bob Johnson", "HVAC", "bob@example.com"));
+    const Technician sampleTechnicians[] = {
+        Technician("TECH001", "John Smith", "Electrical", "john@example.com"),
+        Technician("TECH002", "Jane Doe", "Plumbing", "jane@example.com"),
+        Technician("TECH003", "Bob Johnson", "HVAC", "bob@example.com")
+    };
+    for (const auto& technician : sampleTechnicians) {
+        if (technicianManager.addTechnician(technician)) {
+            registerTechnicianGroups(technician);
+        }
+    }
 
     notifyObservers("initialization", "System initialized with sample data");
 
@@ -399,6 +678,8 @@ bool InterventionManager::initializeWithSampleData() {
 }
 
 bool InterventionManager::optimizeSchedule(std::time_t date) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     // Optimize the schedule for a specific day
     bool success = planner.optimizeSchedule(date);
 
@@ -418,6 +699,8 @@ bool InterventionManager::optimizeSchedule(std::time_t date) {
 
 bool InterventionManager::exportSchedule(const std::string& format,
                                       const std::string& outputFile) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     try {
         std::ofstream file(outputFile);
         if (!file.is_open()) {
@@ -440,13 +723,13 @@ bool InterventionManager::exportSchedule(const std::string& format,
                              std::localtime(&date));
 
                 file << id << ","
-                     << "\"" << intervention->getType() << "\","
-                     << "\"" << intervention->getLocation() << "\","
+                     << "\"" << intervention->getTypeView() << "\","
+                     << "\"" << intervention->getLocationView() << "\","
                      << "\"" << dateBuffer << "\","
                      << intervention->getDuration() << ","
-                     << "\"" << intervention->getTechnicianId() << "\","
-                     << "\"" << intervention->getStatus() << "\","
-                     << "\"" << intervention->getComments() << "\"\n";
+                     << "\"" << intervention->getTechnicianIdView() << "\","
+                     << "\"" << intervention->getStatusView() << "\","
+                     << "\"" << intervention->getCommentsView() << "\"\n";
             }
         } else if (format == "json") {
             // Create a simple JSON output manually
@@ -470,13 +753,13 @@ bool InterventionManager::exportSchedule(const std::string& format,
 
                 file << "    {\n"
                      << "      \"id\": " << id << ",\n"
-                     << "      \"type\": \"" << intervention->getType() << "\",\n"
-                     << "      \"location\": \"" << intervention->getLocation() << "\",\n"
+                     << "      \"type\": \"" << intervention->getTypeView() << "\",\n"
+                     << "      \"location\": \"" << intervention->getLocationView() << "\",\n"
                      << "      \"date\": \"" << dateBuffer << "\",\n"
                      << "      \"duration\": " << intervention->getDuration() << ",\n"
-                     << "      \"technicianId\": \"" << intervention->getTechnicianId() << "\",\n"
-                     << "      \"status\": \"" << intervention->getStatus() << "\",\n"
-                     << "      \"comments\": \"" << intervention->getComments() << "\"\n"
+                     << "      \"technicianId\": \"" << intervention->getTechnicianIdView() << "\",\n"
+                     << "      \"status\": \"" << intervention->getStatusView() << "\",\n"
+                     << "      \"comments\": \"" << intervention->getCommentsView() << "\"\n"
                      << "    }";
             }
 
@@ -508,99 +791,1036 @@ std::string InterventionManager::formatDate(std::time_t date) const {
 }
 
 bool InterventionManager::decorateWithGPS(int interventionId) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     // Find the intervention
-    auto it = interventions.find(interventionId);
-    if (it == interventions.end()) {
+    if (!interventionExists(interventionId)) {
         return false;
     }
 
-    // Apply GPS decorator
-    try {
-        auto decorated = std::make_unique<GPSTrackingDecorator>(std::move(it->second), 15); // 15-minute update frequency
-        it->second = std::move(decorated);
-
-        // Notify observers
-        notifyObservers("decoration",
-                        "Intervention " + std::to_string(interventionId) +
-                        " decorated with GPS tracking capability");
-
+    // The capability is a component: the intervention object stays as it is
+    if (components.has<GPSTrackingComponent>(interventionId)) {
         return true;
-    } catch (const std::exception& e) {
-        std::cerr << "Error applying GPS decorator: " << e.what() << std::endl;
-        return false;
     }
+    components.add<GPSTrackingComponent>(interventionId, 15); // 15-minute update frequency
+
+    // Notify observers
+    notifyObservers("decoration",
+                    "Intervention " + std::to_string(interventionId) +
+                    " decorated with GPS tracking capability",
+                    interventionId);
+
+    return true;
 }
 
 bool InterventionManager::decorateWithAttachments(int interventionId) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     // Find the intervention
-    auto it = interventions.find(interventionId);
-    if (it == interventions.end()) {
+    if (!interventionExists(interventionId)) {
         return false;
     }
 
-    // Apply Attachments decorator
-    try {
-        auto decorated = std::make_unique<AttachmentsDecorator>(std::move(it->second));
-        it->second = std::move(decorated);
-
-        // Notify observers
-        notifyObservers("decoration",
-                        "Intervention " + std::to_string(interventionId) +
-                        " decorated with attachments capability");
-
+    if (components.has<AttachmentsComponent>(interventionId)) {
         return true;
-    } catch (const std::exception& e) {
-        std::cerr << "Error applying Attachments decorator: " << e.what() << std::endl;
-        return false;
     }
+    components.add<AttachmentsComponent>(interventionId);
+
+    // Notify observers
+    notifyObservers("decoration",
+                    "Intervention " + std::to_string(interventionId) +
+                    " decorated with attachments capability",
+                    interventionId);
+
+    return true;
 }
 
 bool InterventionManager::addGPSCoordinate(int interventionId, double latitude, double longitude) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
     // Find the intervention
     auto it = interventions.find(interventionId);
     if (it == interventions.end()) {
         return false;
     }
 
-    // Check if it has GPS decorator
-    GPSTrackingDecorator* gpsDecorator = dynamic_cast<GPSTrackingDecorator*>(it->second.get());
-    if (!gpsDecorator) {
+    // Check if it has GPS tracking
+    GPSTrackingComponent* tracking = components.get<GPSTrackingComponent>(interventionId);
+    if (!tracking) {
         return false;
     }
 
     // Add coordinate
-    gpsDecorator->addCoordinate(latitude, longitude);
+    tracking->addCoordinate(latitude, longitude);
+
+    // The device belongs to the assigned technician: keep their live position
+    std::string techId = it->second->getTechnicianId();
+    if (!techId.empty()) {
+        updateTechnicianPosition(techId, latitude, longitude);
+    }
 
     // Notify observers
     notifyObservers("gps_update",
                    "GPS coordinate added to intervention " + std::to_string(interventionId) +
-                   " (" + std::to_string(latitude) + ", " + std::to_string(longitude) + ")");
+                   " (" + std::to_string(latitude) + ", " + std::to_string(longitude) + ")",
+                   interventionId, techId);
 
     return true;
 }
 
-bool InterventionManager::addAttachment(int interventionId, const std::string& filename, const std::string& description) {
-    // Find the intervention
-    auto it = interventions.find(interventionId);
-    if (it == interventions.end()) {
+size_t InterventionManager::addGPSCoordinates(const std::vector<GPSSample>& samples) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    // Group by intervention, each group in time order
+    std::vector<const GPSSample*> order;
+    order.reserve(samples.size());
+    for (const auto& sample : samples) {
+        order.push_back(&sample);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const GPSSample* a, const GPSSample* b) {
+        return a->interventionId != b->interventionId ? a->interventionId < b->interventionId
+                                                      : a->timestamp < b->timestamp;
+    });
+
+    size_t stored = 0;
+    int groups = 0;
+    for (size_t first = 0; first < order.size();) {
+        int interventionId = order[first]->interventionId;
+        size_t last = first;
+        while (last < order.size() && order[last]->interventionId == interventionId) {
+            ++last;
+        }
+
+        // One lookup for the whole group
+        auto it = interventions.find(interventionId);
+        GPSTrackingComponent* tracking =
+            it != interventions.end() ? components.get<GPSTrackingComponent>(interventionId) : nullptr;
+        if (tracking) {
+            std::string techId = it->second->getTechnicianId();
+            for (size_t i = first; i < last; ++i) {
+                const GPSSample& sample = *order[i];
+                tracking->addCoordinate(sample.latitude, sample.longitude, sample.timestamp);
+                if (!techId.empty()) {
+                    applyGeofences(techId, sample.latitude, sample.longitude);
+                }
+            }
+
+            if (!techId.empty()) {
+                const GPSSample& latest = *order[last - 1];
+                recordTechnicianPosition(techId, latest.latitude, latest.longitude);
+            }
+
+            stored += last - first;
+            groups++;
+        }
+
+        first = last;
+    }
+
+    if (stored > 0) {
+        notifyObservers("gps_batch",
+                        std::to_string(stored) + " GPS coordinate(s) added to " + std::to_string(groups) +
+                        " intervention(s)");
+    }
+
+    return stored;
+}
+
+bool InterventionManager::getTrackSummary(int interventionId, TrackAnalytics::Summary& summary, double siteRadiusKm) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    const GPSTrackingComponent* tracking = components.get<GPSTrackingComponent>(interventionId);
+    if (!tracking) {
+        return false;
+    }
+
+    std::pair<double, double> site;
+    bool hasSite = resolveSiteCoordinates(interventionId, site);
+
+    TrackAnalytics analytics(tracking->getTrackingData());
+    summary = analytics.summarize(hasSite, site.first, site.second, siteRadiusKm);
+    return true;
+}
+
+bool InterventionManager::getTrackPoints(int interventionId, size_t budget,
+                                         std::vector<GPSTrackingComponent::GPSCoordinate>& points) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    const GPSTrackingComponent* tracking = components.get<GPSTrackingComponent>(interventionId);
+    if (!tracking) {
         return false;
     }
 
-    // Check if it has Attachments decorator
-    AttachmentsDecorator* attachmentsDecorator = dynamic_cast<AttachmentsDecorator*>(it->second.get());
-    if (!attachmentsDecorator) {
+    points = tracking->getSimplifiedTrackingData(budget);
+    return true;
+}
+
+bool InterventionManager::addAttachment(int interventionId, const std::string& filename, const std::string& description) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    // Check if it has the attachments capability
+    AttachmentsComponent* attachments = components.get<AttachmentsComponent>(interventionId);
+    if (!attachments) {
         return false;
     }
 
     // Add attachment
-    bool success = attachmentsDecorator->addAttachment(filename, description);
+    bool success = attachments->addAttachment(filename, description);
 
     if (success) {
         // Notify observers
         notifyObservers("attachment_added",
                        "Attachment added to intervention " + std::to_string(interventionId) +
-                       " (" + filename + ")");
+                       " (" + filename + ")",
+                       interventionId);
     }
 
     return success;
-}
\ No newline at end of file
+}
+
+void InterventionManager::setReminderLead(int minutes) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    reminderLeadMinutes = minutes < 0 ? 0 : minutes;
+    for (const auto& pair : interventions) {
+        armInterventionTimers(pair.first);
+    }
+}
+
+void InterventionManager::setEscalationGrace(int minutes) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    escalationGraceMinutes = minutes < 0 ? 0 : minutes;
+    for (const auto& pair : interventions) {
+        armInterventionTimers(pair.first);
+    }
+}
+
+bool InterventionManager::enablePeriodicSnapshots(int intervalMinutes, const std::string& format,
+                                                  const std::string& outputFile) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    if (intervalMinutes <= 0 || outputFile.empty()) {
+        return false;
+    }
+
+    snapshotIntervalMinutes = intervalMinutes;
+    snapshotFormat = format;
+    snapshotFile = outputFile;
+
+    scheduler.cancel(snapshotTimer);
+    snapshotTimer = scheduler.schedule(std::time(nullptr) + snapshotIntervalMinutes * 60,
+                                       [this]() { fireSnapshot(); });
+    return true;
+}
+
+void InterventionManager::disablePeriodicSnapshots() {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    scheduler.cancel(snapshotTimer);
+    snapshotTimer = TimerWheel::INVALID_TIMER;
+    snapshotIntervalMinutes = 0;
+}
+
+size_t InterventionManager::processTimers(std::time_t now) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+    return scheduler.advance(now);
+}
+
+size_t InterventionManager::getPendingTimerCount() const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+    return scheduler.size();
+}
+
+std::unique_lock<std::recursive_mutex> InterventionManager::lockState() const {
+    return std::unique_lock<std::recursive_mutex>(managerMutex);
+}
+
+void InterventionManager::armInterventionTimers(int interventionId) {
+    cancelInterventionTimers(interventionId);
+
+    auto it = interventions.find(interventionId);
+    if (it == interventions.end()) {
+        return;
+    }
+
+    std::time_t date = it->second->getDate();
+    std::time_t now = std::time(nullptr);
+    InterventionTimers timers;
+
+    // Remind the technician ahead of the start
+    if (reminderLeadMinutes > 0 && date - reminderLeadMinutes * 60 > now) {
+        timers.reminder = scheduler.schedule(date - reminderLeadMinutes * 60,
+                                             [this, interventionId]() { fireReminder(interventionId); });
+    }
+
+    // Escalate emergencies that are still waiting after their start
+    if (it->second->getType() == "Emergency") {
+        timers.escalation = scheduler.schedule(date + escalationGraceMinutes * 60,
+                                               [this, interventionId]() { fireEscalation(interventionId); });
+    }
+
+    if (timers.reminder != TimerWheel::INVALID_TIMER || timers.escalation != TimerWheel::INVALID_TIMER) {
+        interventionTimers[interventionId] = timers;
+    }
+}
+
+void InterventionManager::cancelInterventionTimers(int interventionId) {
+    auto it = interventionTimers.find(interventionId);
+    if (it == interventionTimers.end()) {
+        return;
+    }
+
+    scheduler.cancel(it->second.reminder);
+    scheduler.cancel(it->second.escalation);
+    interventionTimers.erase(it);
+}
+
+void InterventionManager::fireReminder(int interventionId) {
+    auto timerIt = interventionTimers.find(interventionId);
+    if (timerIt != interventionTimers.end()) {
+        timerIt->second.reminder = TimerWheel::INVALID_TIMER;
+        if (timerIt->second.reminder == TimerWheel::INVALID_TIMER &&
+            timerIt->second.escalation == TimerWheel::INVALID_TIMER) {
+            interventionTimers.erase(timerIt);
+        }
+    }
+
+    auto it = interventions.find(interventionId);
+    if (it == interventions.end()) {
+        return;
+    }
+
+    std::time_t date = it->second->getDate();
+    char timeBuffer[10];
+    std::strftime(timeBuffer, sizeof(timeBuffer), "%H:%M", std::localtime(&date));
+
+    std::string techId = it->second->getTechnicianId();
+    std::string message = "Reminder: intervention #" + std::to_string(interventionId) +
+                          " at " + it->second->getLocation() + " starts at " + timeBuffer;
+
+    notifyObservers("reminder", message, interventionId, techId);
+
+    if (!techId.empty()) {
+        notificationSystem->notifyTechnician(techId, message);
+    }
+}
+
+void InterventionManager::fireEscalation(int interventionId) {
+    auto timerIt = interventionTimers.find(interventionId);
+    if (timerIt != interventionTimers.end()) {
+        timerIt->second.escalation = TimerWheel::INVALID_TIMER;
+        if (timerIt->second.reminder == TimerWheel::INVALID_TIMER &&
+            timerIt->second.escalation == TimerWheel::INVALID_TIMER) {
+            interventionTimers.erase(timerIt);
+        }
+    }
+
+    auto it = interventions.find(interventionId);
+    if (it == interventions.end() || it->second->getStatus() != "Scheduled") {
+        return; // Deleted or already handled
+    }
+
+    std::string techId = it->second->getTechnicianId();
+    std::string message = "Escalation: emergency intervention #" + std::to_string(interventionId) +
+                          " at " + it->second->getLocation() + " is still scheduled past its start" +
+                          (techId.empty() ? " (no technician assigned)" : "");
+
+    notifyObservers("escalation", message, interventionId, techId);
+}
+
+void InterventionManager::fireSnapshot() {
+    snapshotTimer = TimerWheel::INVALID_TIMER;
+    if (snapshotIntervalMinutes <= 0) {
+        return;
+    }
+
+    if (exportSchedule(snapshotFormat, snapshotFile)) {
+        notifyObservers("snapshot", "Schedule snapshot written to " + snapshotFile);
+    }
+
+    // Re-arm for the next period
+    snapshotTimer = scheduler.schedule(std::time(nullptr) + snapshotIntervalMinutes * 60,
+                                       [this]() { fireSnapshot(); });
+}
+
+void InterventionManager::extendRecurrenceHorizon() {
+    std::time_t now = std::time(nullptr);
+
+    // Occurrences that passed before a free slot was found won't be created anymore
+    size_t missed = recurrences.expireBefore(now);
+    if (missed > 0) {
+        notifyObservers("recurrence", std::to_string(missed) + " recurring interventions missed");
+    }
+
+    materializeRecurrences(now, now + recurrenceHorizonDays * 86400L);
+
+    if (recurrenceTimer == TimerWheel::INVALID_TIMER && recurrences.getSeriesCount() > 0) {
+        recurrenceTimer = scheduler.schedule(now + 86400, [this]() { fireRecurrenceHorizon(); });
+    }
+}
+
+void InterventionManager::fireRecurrenceHorizon() {
+    recurrenceTimer = TimerWheel::INVALID_TIMER;
+    extendRecurrenceHorizon();
+}
+
+void InterventionManager::runScheduler() {
+    std::unique_lock<std::mutex> lock(schedulerWakeMutex);
+
+    while (!schedulerStopping) {
+        schedulerWake.wait_for(lock, std::chrono::seconds(1));
+        if (schedulerStopping) {
+            break;
+        }
+        lock.unlock();
+
+        std::time_t now = std::time(nullptr);
+        processTimers(now);
+
+        // Close the notification digest windows as well
+        notificationSystem->processDigests(now);
+
+        // Tick a copy of the observers so their I/O doesn't block the manager
+        std::vector<std::shared_ptr<InterventionObserver>> ticked;
+        {
+            std::lock_guard<std::recursive_mutex> managerLock(managerMutex);
+            ticked = observers;
+        }
+        for (const auto& observer : ticked) {
+            observer->onTick(now);
+        }
+
+        lock.lock();
+    }
+}
+
+bool InterventionManager::setSiteCoordinates(int interventionId, double latitude, double longitude) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    if (!interventionExists(interventionId)) {
+        return false;
+    }
+
+    siteCoordinates[interventionId] = {latitude, longitude};
+    siteIndex.update(interventionId, latitude, longitude);
+    double radiusKm = geofences.getFenceRadius(interventionId);
+    geofences.setFence(interventionId, latitude, longitude, radiusKm > 0 ? radiusKm : defaultGeofenceRadiusKm);
+    travelTimes.setCoordinates(interventions[interventionId]->getLocation(), latitude, longitude);
+    return true;
+}
+
+int InterventionManager::loadGazetteer(const std::string& filename) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+    return travelTimes.loadGazetteer(filename);
+}
+
+int InterventionManager::resolveLocationsFromTracking() {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    int resolved = 0;
+    components.forEach<GPSTrackingComponent>([&](int interventionId, const GPSTrackingComponent& tracking) {
+        auto it = interventions.find(interventionId);
+        if (it == interventions.end() || tracking.getTrackingPointCount() == 0) {
+            return;
+        }
+
+        // The last fix of the technician on site stands for the location
+        std::string location = it->second->getLocation();
+        if (travelTimes.isResolved(location)) {
+            return;
+        }
+
+        auto last = tracking.getCurrentLocation();
+        travelTimes.setCoordinates(location, last.first, last.second);
+        resolved++;
+    });
+
+    return resolved;
+}
+
+double InterventionManager::getTravelMinutes(int fromInterventionId, int toInterventionId) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    auto fromIt = interventions.find(fromInterventionId);
+    auto toIt = interventions.find(toInterventionId);
+    if (fromIt == interventions.end() || toIt == interventions.end()) {
+        return -1;
+    }
+
+    return travelTimes.getTravelMinutes(travelTimes.intern(fromIt->second->getLocation()),
+                                        travelTimes.intern(toIt->second->getLocation()));
+}
+
+TravelTimeService& InterventionManager::getTravelTimeService() {
+    return travelTimes;
+}
+
+std::shared_ptr<NotificationSystem> InterventionManager::getNotificationSystem() const {
+    return notificationSystem;
+}
+
+void InterventionManager::updateTechnicianPosition(const std::string& technicianId, double latitude, double longitude) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+    recordTechnicianPosition(technicianId, latitude, longitude);
+    applyGeofences(technicianId, latitude, longitude);
+}
+
+void InterventionManager::recordTechnicianPosition(const std::string& technicianId, double latitude, double longitude) {
+    technicianPositions[technicianId] = {latitude, longitude};
+    technicianIndex.update(technicianId, latitude, longitude);
+
+    // Interned under a name no location string uses, so travel times reach technicians too
+    technicianLocations[technicianId] = travelTimes.setCoordinates("\x1ftechnician:" + technicianId, latitude, longitude);
+}
+
+void InterventionManager::applyGeofences(const std::string& technicianId, double latitude, double longitude) {
+    for (const auto& transition : geofences.update(technicianId, latitude, longitude)) {
+        auto it = interventions.find(transition.fenceId);
+        if (it == interventions.end()) {
+            continue;
+        }
+
+        notifyObservers(transition.arrival ? "arrival" : "departure",
+                        "Technician " + technicianId + (transition.arrival ? " arrived at" : " left") +
+                        " the site of intervention " + std::to_string(transition.fenceId),
+                        transition.fenceId, technicianId);
+
+        // Only the assigned technician moves the intervention along
+        if (it->second->getTechnicianIdView() != technicianId) {
+            continue;
+        }
+
+        std::string_view status = it->second->getStatusView();
+        if (transition.arrival && geofenceStartOnArrival && status == "Scheduled") {
+            changeInterventionStatus(transition.fenceId, "In Progress", "Arrival detected on site");
+        } else if (!transition.arrival && geofenceCompleteOnDeparture && status == "In Progress") {
+            changeInterventionStatus(transition.fenceId, "Completed", "Departure detected from site");
+        }
+    }
+}
+
+bool InterventionManager::setGeofenceRadius(int interventionId, double radiusKm) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    auto siteIt = siteCoordinates.find(interventionId);
+    if (siteIt == siteCoordinates.end()) {
+        return false;
+    }
+
+    return geofences.setFence(interventionId, siteIt->second.first, siteIt->second.second, radiusKm);
+}
+
+bool InterventionManager::setGeofenceAutoStatus(bool startOnArrival, bool completeOnDeparture) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+    geofenceStartOnArrival = startOnArrival;
+    geofenceCompleteOnDeparture = completeOnDeparture;
+    return true;
+}
+
+int InterventionManager::createRecurringIntervention(const std::string& type, const std::string& location,
+                                                     std::time_t start, int duration, const RecurrenceRule& rule) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    if (duration <= 0) {
+        return -1;
+    }
+
+    // The factory builds the prototype once; occurrences are copies of it
+    auto prototype = factoryRegistry.createIntervention(factoryRegistry.resolveType(type), location, start, duration);
+    if (!prototype) {
+        return -1;
+    }
+
+    int seriesId = recurrences.addSeries(std::move(prototype), rule);
+    if (seriesId == -1) {
+        return -1;
+    }
+
+    notifyObservers("recurrence", "Recurring series " + std::to_string(seriesId) + " created (" + type + ", " +
+                    rule.toString() + ")");
+
+    extendRecurrenceHorizon();
+    return seriesId;
+}
+
+bool InterventionManager::deleteRecurringSeries(int seriesId) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    if (!recurrences.removeSeries(seriesId)) {
+        return false;
+    }
+
+    // Materialized occurrences become ordinary interventions
+    for (auto it = recurringOccurrences.begin(); it != recurringOccurrences.end();) {
+        if (it->second.first == seriesId) {
+            it = recurringOccurrences.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (recurrences.getSeriesCount() == 0) {
+        scheduler.cancel(recurrenceTimer);
+        recurrenceTimer = TimerWheel::INVALID_TIMER;
+    }
+
+    notifyObservers("recurrence", "Recurring series " + std::to_string(seriesId) + " deleted");
+    return true;
+}
+
+bool InterventionManager::cancelOccurrence(int seriesId, int index) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    int interventionId = recurrences.getMaterializedId(seriesId, index);
+    if (interventionId != -1) {
+        return deleteIntervention(interventionId); // Records the cancellation as well
+    }
+
+    return recurrences.cancelOccurrence(seriesId, index);
+}
+
+bool InterventionManager::moveOccurrence(int seriesId, int index, std::time_t date) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    int interventionId = recurrences.getMaterializedId(seriesId, index);
+    if (interventionId != -1) {
+        return modifyIntervention(interventionId, "", date, 0);
+    }
+
+    if (!recurrences.moveOccurrence(seriesId, index, date)) {
+        return false;
+    }
+
+    // The new date may fall within the horizon already
+    extendRecurrenceHorizon();
+    return true;
+}
+
+size_t InterventionManager::materializeRecurrences(std::time_t from, std::time_t to) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    std::vector<RecurrenceEngine::Occurrence> pending = recurrences.expand(from, to);
+    if (pending.empty()) {
+        return 0;
+    }
+
+    // Copy the prototypes and book them all in one pass over the planner
+    std::vector<std::unique_ptr<Intervention>> created;
+    std::vector<InterventionPlanner::Booking> bookings;
+    created.reserve(pending.size());
+    bookings.reserve(pending.size());
+    for (const auto& occurrence : pending) {
+        created.push_back(recurrences.instantiate(occurrence));
+        bookings.push_back({-1, occurrence.date, occurrence.duration, false});
+    }
+    // IDs go to the bookings the planner accepts only: a full day is retried later
+    planner.scheduleInterventions(bookings, &nextInterventionId);
+
+    size_t count = 0;
+    for (size_t i = 0; i < created.size(); ++i) {
+        if (!bookings[i].scheduled) {
+            continue; // Day full: left pending
+        }
+
+        int id = bookings[i].interventionId;
+        created[i]->setId(id);
+        if (const auto* emergency = asEmergency(created[i].get())) {
+            dispatchQueue.push(id, emergency->getPriority(), emergency->getRequiredSpecialty());
+        }
+        interventions[id] = std::move(created[i]);
+        armInterventionTimers(id);
+
+        recurrences.markMaterialized(pending[i].seriesId, pending[i].index, id);
+        recurringOccurrences[id] = {pending[i].seriesId, pending[i].index};
+        ++count;
+    }
+
+    if (count > 0) {
+        notifyObservers("recurrence", std::to_string(count) + " recurring interventions created");
+    }
+    return count;
+}
+
+bool InterventionManager::setRecurrenceHorizon(int days) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    recurrenceHorizonDays = days < 1 ? 1 : days;
+    extendRecurrenceHorizon();
+    return true;
+}
+
+const RecurrenceEngine& InterventionManager::getRecurrences() const {
+    return recurrences;
+}
+
+std::string InterventionManager::getRecurringSeriesInfo(int seriesId) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    const Intervention* prototype = recurrences.getPrototype(seriesId);
+    if (prototype == nullptr) {
+        return "";
+    }
+
+    std::string info(prototype->getTypeView());
+    info += " at ";
+    info += prototype->getLocationView();
+    info += ", " + recurrences.getRule(seriesId)->toString() + ", " +
+            std::to_string(recurrences.getMissedCount(seriesId)) + " missed";
+    return info;
+}
+
+std::vector<RecurrenceEngine::Occurrence> InterventionManager::getPendingOccurrences(int seriesId, std::time_t from,
+                                                                                     std::time_t to) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    return recurrences.expandSeries(seriesId, from, to);
+}
+
+std::vector<std::pair<int, double>> InterventionManager::findInterventionsWithin(double latitude, double longitude,
+                                                                                 double radiusKm) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    std::vector<std::pair<int, double>> result;
+    for (const auto& match : siteIndex.withinRadius(latitude, longitude, radiusKm)) {
+        result.emplace_back(match.key, match.distanceKm);
+    }
+    return result;
+}
+
+std::vector<std::pair<std::string, double>> InterventionManager::findNearestTechnicians(double latitude, double longitude,
+                                                                                        size_t count) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    std::vector<std::pair<std::string, double>> result;
+    for (const auto& match : technicianIndex.nearest(latitude, longitude, count)) {
+        result.emplace_back(match.key, match.distanceKm);
+    }
+    return result;
+}
+
+size_t InterventionManager::getDispatchQueueSize() const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+    return dispatchQueue.size();
+}
+
+DispatchProposal InterventionManager::proposeDispatch(bool allowPreemption) const {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    DispatchProposal proposal;
+    size_t skipped = 0;
+    dispatchQueue.visitInOrder([&](const DispatchQueue::Job& job) {
+        if (interventions.find(job.interventionId) == interventions.end()) {
+            return true;
+        }
+
+        // Report the most urgent emergency if nobody can take any of them
+        if (proposal.interventionId == -1) {
+            proposal.interventionId = job.interventionId;
+        }
+
+        DispatchProposal candidate;
+        if (!proposeTechnician(job, allowPreemption, candidate)) {
+            // Bound the work of one decision when many jobs are stuck
+            return ++skipped <= MAX_DISPATCH_SKIPS;
+        }
+
+        candidate.interventionId = job.interventionId;
+        proposal = std::move(candidate);
+        return false;
+    });
+
+    return proposal;
+}
+
+bool InterventionManager::proposeTechnician(const DispatchQueue::Job& job, bool allowPreemption,
+                                            DispatchProposal& proposal) const {
+    const Intervention* intervention = interventions.at(job.interventionId).get();
+    std::time_t date = intervention->getDate();
+    int duration = intervention->getDuration();
+
+    // Technicians with an unknown position rank after every located one
+    const double UNKNOWN_MINUTES = 1e9;
+
+    // First choice: the nearest free technician with the right specialty.
+    // Travel times are only computed for the technicians who qualify.
+    std::vector<std::string> candidates;
+    std::vector<std::vector<int>> bumps;
+    for (const auto& techPair : technicianManager.getAllTechnicians()) {
+        if ((job.specialty.empty() || techPair.second.getSpecialty() == job.specialty) &&
+            technicianManager.isTechnicianAvailable(techPair.first, date, duration, true)) {
+            candidates.push_back(techPair.first);
+        }
+    }
+
+    // Nobody is free: those who can be freed by bumping lower-priority maintenance jobs
+    if (candidates.empty() && allowPreemption) {
+        for (const auto& techPair : technicianManager.getAllTechnicians()) {
+            std::vector<int> bumped;
+            if ((job.specialty.empty() || techPair.second.getSpecialty() == job.specialty) &&
+                technicianManager.isOnShift(techPair.first, date, duration, true) &&
+                findPreemptableInterventions(techPair.first, date, duration, bumped)) {
+                candidates.push_back(techPair.first);
+                bumps.push_back(std::move(bumped));
+            }
+        }
+    }
+
+    if (candidates.empty()) {
+        return false;
+    }
+    std::vector<double> minutes = travelMinutesToSite(job.interventionId, candidates);
+
+    // Fewest bumps first (none for free technicians), then nearest
+    size_t bestBumps = 0;
+    double bestScore = 0;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        size_t bumpCount = bumps.empty() ? 0 : bumps[i].size();
+        double score = minutes[i] < 0 ? UNKNOWN_MINUTES : minutes[i];
+        if (proposal.technicianId.empty() || bumpCount < bestBumps ||
+            (bumpCount == bestBumps && score < bestScore)) {
+            bestBumps = bumpCount;
+            bestScore = score;
+            proposal.technicianId = candidates[i];
+            proposal.travelMinutes = minutes[i];
+            if (!bumps.empty()) {
+                proposal.preempted = bumps[i];
+            }
+        }
+    }
+
+    return true;
+}
+
+bool InterventionManager::dispatchNextEmergency(bool allowPreemption) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    DispatchProposal proposal = proposeDispatch(allowPreemption);
+    if (proposal.technicianId.empty()) {
+        return false;
+    }
+
+    // Free the technician from the maintenance jobs being bumped
+    std::vector<Intervention*> bumped;
+    for (int bumpedId : proposal.preempted) {
+        auto it = interventions.find(bumpedId);
+        if (it == interventions.end()) {
+            continue;
+        }
+
+        technicianManager.unassignTechnician(proposal.technicianId, it->second->getDate());
+        it->second->setTechnicianId("");
+        bumped.push_back(it->second.get());
+    }
+
+    if (!assignTechnician(proposal.interventionId, proposal.technicianId)) {
+        // Give the bumped jobs back: nobody was told about them yet. Their
+        // slots were just freed, so on-call windows may be used to take them back.
+        for (Intervention* intervention : bumped) {
+            if (technicianManager.assignTechnician(proposal.technicianId, intervention->getDate(),
+                                                   intervention->getDuration(), true)) {
+                intervention->setTechnicianId(proposal.technicianId);
+                continue;
+            }
+
+            int bumpedId = intervention->getId();
+            std::string message = "Intervention " + std::to_string(bumpedId) +
+                                  " unassigned: it could not be given back after a failed emergency dispatch";
+            notifyObservers("preemption", message, bumpedId, proposal.technicianId);
+            notificationSystem->notifyTechnician(proposal.technicianId,
+                "You have been unassigned from intervention #" + std::to_string(bumpedId));
+        }
+        return false;
+    }
+
+    for (const Intervention* intervention : bumped) {
+        int bumpedId = intervention->getId();
+        std::string message = "Intervention " + std::to_string(bumpedId) +
+                              " unassigned to dispatch emergency " + std::to_string(proposal.interventionId);
+        notifyObservers("preemption", message, bumpedId, proposal.technicianId);
+        notificationSystem->notifyTechnician(proposal.technicianId,
+            "You have been unassigned from intervention #" + std::to_string(bumpedId) +
+            " to handle emergency #" + std::to_string(proposal.interventionId));
+    }
+
+    return true;
+}
+
+std::vector<double> InterventionManager::travelMinutesToSite(int interventionId,
+                                                            const std::vector<std::string>& technicianIds) const {
+    std::vector<TravelTimeService::LocationId> positions;
+    positions.reserve(technicianIds.size());
+    for (const auto& technicianId : technicianIds) {
+        auto it = technicianLocations.find(technicianId);
+        positions.push_back(it != technicianLocations.end() ? it->second : TravelTimeService::INVALID_LOCATION);
+    }
+
+    // Explicit site coordinates are stored on the location too (setSiteCoordinates)
+    auto it = interventions.find(interventionId);
+    TravelTimeService::LocationId site = it != interventions.end()
+        ? travelTimes.findLocation(it->second->getLocation())
+        : TravelTimeService::INVALID_LOCATION;
+    return travelTimes.getTravelMinutesBatch(site, positions, false); // Technicians move: don't cache
+}
+
+bool InterventionManager::resolveSiteCoordinates(int interventionId, std::pair<double, double>& coordinates) const {
+    auto siteIt = siteCoordinates.find(interventionId);
+    if (siteIt != siteCoordinates.end()) {
+        coordinates = siteIt->second;
+        return true;
+    }
+
+    // Fall back on the coordinates known for the location string
+    auto it = interventions.find(interventionId);
+    if (it == interventions.end()) {
+        return false;
+    }
+
+    auto locationId = travelTimes.findLocation(it->second->getLocation());
+    return locationId != TravelTimeService::INVALID_LOCATION &&
+           travelTimes.getCoordinates(locationId, coordinates.first, coordinates.second);
+}
+
+const EmergencyIntervention* InterventionManager::asEmergency(const Intervention* intervention) {
+    // Look through decorators for the underlying emergency
+    while (const auto* decorator = dynamic_cast<const InterventionDecorator*>(intervention)) {
+        intervention = decorator->getWrappedIntervention();
+    }
+    return dynamic_cast<const EmergencyIntervention*>(intervention);
+}
+
+bool InterventionManager::findPreemptableInterventions(const std::string& technicianId, std::time_t date,
+                                                       int duration, std::vector<int>& bumped) const {
+    // Only the technician's overlapping assignments are in the way
+    for (const auto& assignment : technicianManager.getOverlappingAssignments(technicianId, date, duration)) {
+        // The planner indexes the interventions by day: find the one behind the assignment
+        const Intervention* blocking = nullptr;
+        for (int id : planner.getInterventionsForDay(assignment.first)) {
+            auto it = interventions.find(id);
+            if (it != interventions.end() && it->second->getDate() == assignment.first &&
+                it->second->getTechnicianId() == technicianId) {
+                blocking = it->second.get();
+                break;
+            }
+        }
+
+        // Emergencies, work already started and unknown assignments are never bumped
+        if (!blocking || blocking->getType() != "Maintenance" || blocking->getStatus() != "Scheduled") {
+            bumped.clear();
+            return false;
+        }
+        bumped.push_back(blocking->getId());
+    }
+
+    return !bumped.empty();
+}
+
+AutoAssignReport InterventionManager::autoAssignTechnicians(bool greedy, int maxRounds) {
+    std::lock_guard<std::recursive_mutex> lock(managerMutex);
+
+    AutoAssignReport report;
+
+    // Sites or technicians without a known position are assumed this far apart
+    const double UNKNOWN_TRAVEL_MINUTES = 60.0;
+
+    std::vector<std::string> technicianIds;
+    std::vector<std::string> technicianSpecialties;
+    for (const auto& techPair : technicianManager.getAllTechnicians()) {
+        technicianIds.push_back(techPair.first);
+        technicianSpecialties.push_back(techPair.second.getSpecialty());
+    }
+
+    // A matching gives each technician at most one intervention, so repeat
+    // until every intervention is placed or nothing more can be assigned
+    for (int round = 0; round < maxRounds; ++round) {
+        std::vector<const Intervention*> pending;
+        std::vector<std::string> specialties;
+        std::vector<char> emergencies;
+        std::vector<std::vector<double>> travelMinutes; // Row -> minutes to each technician
+        for (const auto& pair : interventions) {
+            if (!pair.second->getTechnicianId().empty() || pair.second->getStatus() != "Scheduled") {
+                continue;
+            }
+            pending.push_back(pair.second.get());
+            travelMinutes.push_back(travelMinutesToSite(pair.first, technicianIds));
+
+            const auto* emergency = asEmergency(pair.second.get());
+            specialties.push_back(emergency ? emergency->getRequiredSpecialty() : "");
+            emergencies.push_back(emergency != nullptr);
+        }
+
+        if (round == 0) {
+            report.considered = pending.size();
+        }
+        if (pending.empty() || technicianIds.empty()) {
+            break;
+        }
+
+        // Only reads shared state, so rows can be computed in parallel
+        auto cost = [&](size_t row, size_t col) {
+            const Intervention* intervention = pending[row];
+            const std::string& techId = technicianIds[col];
+
+            if (!specialties[row].empty() && technicianSpecialties[col] != specialties[row]) {
+                return AssignmentSolver::FORBIDDEN;
+            }
+            if (!technicianManager.isTechnicianAvailable(techId, intervention->getDate(),
+                                                         intervention->getDuration(), emergencies[row])) {
+                return AssignmentSolver::FORBIDDEN;
+            }
+
+            return travelMinutes[row][col] < 0 ? UNKNOWN_TRAVEL_MINUTES : travelMinutes[row][col];
+        };
+
+        auto matrix = AssignmentSolver::buildCostMatrix(pending.size(), technicianIds.size(), cost);
+        auto matching = greedy ? AssignmentSolver::solveGreedy(matrix) : AssignmentSolver::solveOptimal(matrix);
+
+        // Reserve every slot first so the round is applied all or nothing
+        std::vector<std::pair<size_t, size_t>> reserved;
+        bool complete = true;
+        for (size_t row = 0; row < matching.size(); ++row) {
+            if (matching[row] < 0) {
+                continue;
+            }
+            size_t col = static_cast<size_t>(matching[row]);
+            if (!technicianManager.assignTechnician(technicianIds[col], pending[row]->getDate(),
+                                                    pending[row]->getDuration(), emergencies[row])) {
+                complete = false;
+                break;
+            }
+            reserved.push_back({row, col});
+        }
+
+        if (!complete) {
+            for (const auto& pair : reserved) {
+                technicianManager.unassignTechnician(technicianIds[pair.second], pending[pair.first]->getDate());
+            }
+            break;
+        }
+        if (reserved.empty()) {
+            break;
+        }
+
+        for (const auto& pair : reserved) {
+            int interventionId = pending[pair.first]->getId();
+            const std::string& techId = technicianIds[pair.second];
+
+            interventions[interventionId]->setTechnicianId(techId);
+            dispatchQueue.remove(interventionId);
+
+            notifyObservers("technician_assignment",
+                           "Technician " + techId + " assigned to intervention " +
+                           std::to_string(interventionId),
+                           interventionId, techId);
+            notificationSystem->notifyTechnician(techId,
+                "You have been assigned to intervention #" + std::to_string(interventionId) +
+                " at " + pending[pair.first]->getLocation());
+        }
+
+        report.assigned += reserved.size();
+        report.totalTravelMinutes += AssignmentSolver::totalCost(matrix, matching);
+        report.rounds = round + 1;
+    }
+
+    return report;
+}
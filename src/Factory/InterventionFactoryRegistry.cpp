@@ -4,24 +4,105 @@
 
 #include "Factory/InterventionFactoryRegistry.h"
 
+InterventionFactoryRegistry::InterventionFactoryRegistry()
+    : frozen(false), hashSeed(0), hashMask(0) {
+}
+
 InterventionFactoryRegistry& InterventionFactoryRegistry::getInstance() {
     static InterventionFactoryRegistry instance;
     return instance;
 }
 
-void InterventionFactoryRegistry::registerFactory(
+std::uint64_t InterventionFactoryRegistry::hashName(std::string_view name, std::uint64_t seed) {
+    // FNV-1a with a seeded basis and a final mix of the high bits
+    std::uint64_t hash = 14695981039346656037ull ^ (seed * 0x9E3779B97F4A7C15ull);
+    for (unsigned char c : name) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash ^ (hash >> 32);
+}
+
+InterventionFactoryRegistry::TypeId InterventionFactoryRegistry::registerFactory(
     const std::string& type,
     std::unique_ptr<InterventionFactory> factory) {
+    if (frozen) {
+        return INVALID_TYPE;
+    }
+
+    auto it = typeIds.find(type);
+    if (it != typeIds.end()) {
+        factories[it->second] = std::move(factory);
+        return it->second;
+    }
 
-    factories[type] = std::move(factory);
+    TypeId id = static_cast<TypeId>(factories.size());
+    factories.push_back(std::move(factory));
+    typeNames.push_back(type);
+    typeIds[type] = id;
+    return id;
 }
 
-const InterventionFactory* InterventionFactoryRegistry::getFactory(const std::string& type) const {
-    auto it = factories.find(type);
-    if (it != factories.end()) {
-        return it->second.get();
+void InterventionFactoryRegistry::freeze() {
+    if (frozen) {
+        return;
+    }
+
+    // Find a seed that sends every name to its own slot; widen the table if
+    // none does at this size
+    size_t size = 1;
+    while (size < typeNames.size() * 2) {
+        size *= 2;
+    }
+
+    for (;;) {
+        for (std::uint64_t seed = 0; seed < 64; ++seed) {
+            std::vector<TypeId> slots(size, INVALID_TYPE);
+            bool collision = false;
+            for (size_t id = 0; id < typeNames.size() && !collision; ++id) {
+                TypeId& slot = slots[hashName(typeNames[id], seed) & (size - 1)];
+                collision = slot != INVALID_TYPE;
+                slot = static_cast<TypeId>(id);
+            }
+
+            if (!collision) {
+                hashSeed = seed;
+                hashMask = size - 1;
+                hashSlots = std::move(slots);
+                frozen = true;
+                return;
+            }
+        }
+        size *= 2;
+    }
+}
+
+bool InterventionFactoryRegistry::isFrozen() const {
+    return frozen;
+}
+
+InterventionFactoryRegistry::TypeId InterventionFactoryRegistry::resolveType(std::string_view type) const {
+    if (!frozen) {
+        auto it = typeIds.find(std::string(type));
+        return it != typeIds.end() ? it->second : INVALID_TYPE;
     }
-    return nullptr;
+
+    // One hash, one slot, one comparison to reject unknown names
+    TypeId id = hashSlots[hashName(type, hashSeed) & hashMask];
+    return id != INVALID_TYPE && typeNames[id] == type ? id : INVALID_TYPE;
+}
+
+const std::string& InterventionFactoryRegistry::getTypeName(TypeId typeId) const {
+    static const std::string NONE;
+    return typeId >= 0 && static_cast<size_t>(typeId) < typeNames.size() ? typeNames[typeId] : NONE;
+}
+
+size_t InterventionFactoryRegistry::getTypeCount() const {
+    return factories.size();
+}
+
+const InterventionFactory* InterventionFactoryRegistry::getFactory(const std::string& type) const {
+    return getFactory(resolveType(type));
 }
 
 std::unique_ptr<Intervention> InterventionFactoryRegistry::createIntervention(
@@ -29,10 +110,5 @@ std::unique_ptr<Intervention> InterventionFactoryRegistry::createIntervention(
     const std::string& location,
     std::time_t date,
     int duration) const {
-
-    const InterventionFactory* factory = getFactory(type);
-    if (factory) {
-        return factory->createIntervention(location, date, duration);
-    }
-    return nullptr;
-}
\ No newline at end of file
+    return createIntervention(resolveType(type), location, date, duration);
+}
@@ -6,12 +6,19 @@
 #include "Model/EmergencyIntervention.h"
 #include <sstream>
 
+namespace {
+    const char* const TYPE_NAME = "Emergency";
+}
+
 EmergencyIntervention::EmergencyIntervention()
     : Intervention(), priority(3) {
+    typeName = TYPE_NAME;
 }
 
 EmergencyIntervention::EmergencyIntervention(const std::string& location, std::time_t date, int duration, int priority)
     : Intervention(location, date, duration), priority(priority) {
+    typeName = TYPE_NAME;
+
     // Validate priority between 1 and 5
     if (priority < 1) this->priority = 1;
     else if (priority > 5) this->priority = 5;
@@ -19,7 +26,11 @@ EmergencyIntervention::EmergencyIntervention(const std::string& location, std::t
 }
 
 std::string EmergencyIntervention::getType() const {
-    return "Emergency";
+    return TYPE_NAME;
+}
+
+std::unique_ptr<Intervention> EmergencyIntervention::clone() const {
+    return std::make_unique<EmergencyIntervention>(*this);
 }
 
 int EmergencyIntervention::getPriority() const {
@@ -32,6 +43,14 @@ void EmergencyIntervention::setPriority(int priority) {
     else this->priority = priority;
 }
 
+std::string EmergencyIntervention::getRequiredSpecialty() const {
+    return requiredSpecialty;
+}
+
+void EmergencyIntervention::setRequiredSpecialty(const std::string& specialty) {
+    requiredSpecialty = specialty;
+}
+
 std::string EmergencyIntervention::getInfo() const {
     // Get base information
     std::string baseInfo = Intervention::getInfo();
@@ -41,5 +60,9 @@ std::string EmergencyIntervention::getInfo() const {
     oss << baseInfo << std::endl
         << "Priority: " << priority << "/5";
 
+    if (!requiredSpecialty.empty()) {
+        oss << std::endl << "Required specialty: " << requiredSpecialty;
+    }
+
     return oss.str();
 }
\ No newline at end of file
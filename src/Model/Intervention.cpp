@@ -5,14 +5,82 @@
 #include <sstream>
 #include <iomanip>
 #include <ctime>
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace {
+    const size_t POOL_GRANULARITY = alignof(std::max_align_t);
+    const size_t MAX_POOLED_SIZE = 1024; // Larger types use the global heap
+    const size_t POOL_COUNT = MAX_POOLED_SIZE / POOL_GRANULARITY + 1;
+
+    /**
+     * @brief One pool per object size, created on first use
+     */
+    struct PoolTable {
+        std::mutex mutex;
+        std::atomic<SlabPool*> pools[POOL_COUNT] = {};
+    };
+
+    PoolTable& poolTable() {
+        // Never destroyed: interventions may still be freed during static destruction
+        static PoolTable* table = new PoolTable();
+        return *table;
+    }
+
+    SlabPool* poolFor(size_t size) {
+        if (size > MAX_POOLED_SIZE) {
+            return nullptr;
+        }
+
+        PoolTable& table = poolTable();
+        std::atomic<SlabPool*>& slot = table.pools[(size + POOL_GRANULARITY - 1) / POOL_GRANULARITY];
+        SlabPool* pool = slot.load(std::memory_order_acquire);
+        if (pool) {
+            return pool;
+        }
+
+        std::lock_guard<std::mutex> lock(table.mutex);
+        pool = slot.load(std::memory_order_relaxed);
+        if (!pool) {
+            pool = new SlabPool(size);
+            slot.store(pool, std::memory_order_release);
+        }
+        return pool;
+    }
+}
+
+void* Intervention::operator new(std::size_t size) {
+    SlabPool* pool = poolFor(size);
+    return pool ? pool->allocate() : ::operator new(size);
+}
+
+void Intervention::operator delete(void* pointer, std::size_t size) noexcept {
+    SlabPool* pool = poolFor(size);
+    if (pool) {
+        pool->deallocate(pointer);
+    } else {
+        ::operator delete(pointer);
+    }
+}
+
+std::vector<SlabPool::Stats> Intervention::getAllocationStats() {
+    std::vector<SlabPool::Stats> stats;
+    for (auto& slot : poolTable().pools) {
+        if (SlabPool* pool = slot.load(std::memory_order_acquire)) {
+            stats.push_back(pool->getStats());
+        }
+    }
+    return stats;
+}
 
 Intervention::Intervention()
-    : id(0), location(""), date(0), duration(0),
+    : fieldOwner(nullptr), id(0), location(""), date(0), duration(0),
       technicianId(""), status("Scheduled"), comments("") {
 }
 
 Intervention::Intervention(const std::string& location, std::time_t date, int duration)
-    : id(0), location(location), date(date), duration(duration),
+    : fieldOwner(nullptr), id(0), location(location), date(date), duration(duration),
       technicianId(""), status("Scheduled"), comments("") {
 }
 
@@ -4,14 +4,24 @@
 
 #include "Model/MaintenanceIntervention.h"
 
+namespace {
+    const char* const TYPE_NAME = "Maintenance";
+}
+
 MaintenanceIntervention::MaintenanceIntervention()
     : Intervention() {
+    typeName = TYPE_NAME;
 }
 
 MaintenanceIntervention::MaintenanceIntervention(const std::string& location, std::time_t date, int duration)
     : Intervention(location, date, duration) {
+    typeName = TYPE_NAME;
 }
 
 std::string MaintenanceIntervention::getType() const {
-    return "Maintenance";
+    return TYPE_NAME;
+}
+
+std::unique_ptr<Intervention> MaintenanceIntervention::clone() const {
+    return std::make_unique<MaintenanceIntervention>(*this);
 }
\ No newline at end of file
@@ -0,0 +1,81 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Model/SlabPool.h"
+#include <algorithm>
+
+SlabPool::SlabPool(size_t slotSize, std::pmr::memory_resource* upstream)
+    : slotSize(0), nextSlabSlots(FIRST_SLAB_SLOTS),
+      upstream(upstream ? upstream : std::pmr::new_delete_resource()),
+      freeList(nullptr), cursor(nullptr), cursorEnd(nullptr), slotsInUse(0), slotCapacity(0) {
+    // Every slot must hold a free-list link and keep the next one aligned
+    const size_t ALIGNMENT = alignof(std::max_align_t);
+    size_t size = std::max(slotSize, sizeof(FreeSlot));
+    this->slotSize = (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+SlabPool::~SlabPool() {
+    for (const auto& slab : slabs) {
+        upstream->deallocate(slab.memory, slab.bytes, alignof(std::max_align_t));
+    }
+}
+
+void SlabPool::grow() {
+    size_t bytes = nextSlabSlots * slotSize;
+    void* memory = upstream->allocate(bytes, alignof(std::max_align_t));
+    slabs.push_back({memory, bytes});
+
+    cursor = static_cast<char*>(memory);
+    cursorEnd = cursor + bytes;
+    slotCapacity += nextSlabSlots;
+    nextSlabSlots = std::min(nextSlabSlots * 2, MAX_SLAB_SLOTS);
+}
+
+void* SlabPool::allocate() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    slotsInUse++;
+
+    // Reuse a freed slot first
+    if (freeList) {
+        FreeSlot* slot = freeList;
+        freeList = slot->next;
+        return slot;
+    }
+
+    if (cursor == cursorEnd) {
+        grow();
+    }
+
+    void* slot = cursor;
+    cursor += slotSize;
+    return slot;
+}
+
+void SlabPool::deallocate(void* slot) {
+    if (!slot) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    FreeSlot* freed = static_cast<FreeSlot*>(slot);
+    freed->next = freeList;
+    freeList = freed;
+    slotsInUse--;
+}
+
+SlabPool::Stats SlabPool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    Stats stats;
+    stats.slotSize = slotSize;
+    stats.slotsInUse = slotsInUse;
+    stats.slotCapacity = slotCapacity;
+    stats.slabCount = slabs.size();
+    for (const auto& slab : slabs) {
+        stats.bytesReserved += slab.bytes;
+    }
+    return stats;
+}
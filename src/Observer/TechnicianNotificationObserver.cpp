@@ -6,28 +6,107 @@
 #include "Observer/TechnicianNotificationObserver.h"
 #include <regex>
 #include <string>
+#include <sstream>
 
-TechnicianNotificationObserver::TechnicianNotificationObserver(std::shared_ptr<NotificationSystem> notificationSystem)
-    : notificationSystem(notificationSystem) {
+TechnicianNotificationObserver::TechnicianNotificationObserver(std::shared_ptr<NotificationSystem> notificationSystem,
+                                                               int digestInterval, bool notifyTechnicians)
+    : notificationSystem(notificationSystem),
+      pendingCount(0),
+      digestInterval(digestInterval < 0 ? 0 : digestInterval),
+      digestWindowStart(std::time(nullptr)),
+      notifyTechnicians(notifyTechnicians) {
 }
 
-void TechnicianNotificationObserver::notify(const std::string& message) {
-    if (!notificationSystem) {
-        return; // No notification system available
-    }
+TechnicianNotificationObserver::~TechnicianNotificationObserver() {
+    flushDigest();
+}
 
+void TechnicianNotificationObserver::notify(const std::string& message) {
     // Extract technician ID from the message if present
-    // This is a simple approach - in a real system, we might pass structured data instead of strings
-    std::regex technicianPattern("Technician: ([A-Z0-9]+)");
+    // The pattern is compiled once; structured events go through notifyEvent() and skip it
+    static const std::regex technicianPattern("Technician: ([A-Z0-9]+)");
     std::smatch match;
 
     if (std::regex_search(message, match, technicianPattern) && match.size() > 1) {
-        std::string technicianId = match[1].str();
+        route(match[1].str(), message);
+    } else {
+        route("", message);
+    }
+}
 
+void TechnicianNotificationObserver::notifyEvent(const InterventionEvent& event) {
+    route(event.technicianId, event.message);
+}
+
+void TechnicianNotificationObserver::route(const std::string& technicianId, const std::string& message) {
+    if (!notificationSystem) {
+        return; // No notification system available
+    }
+
+    if (!technicianId.empty()) {
         // Notify the technician
-        notificationSystem->notifyTechnician(technicianId, message);
+        if (notifyTechnicians) {
+            notificationSystem->notifyTechnician(technicianId, message);
+        }
+        return;
+    }
+
+    // No specific technician: aggregate into the next digest
+    std::lock_guard<std::mutex> lock(digestMutex);
+    pendingDigest.push_back(message);
+    if (pendingDigest.size() > MAX_DIGEST_LINES) {
+        pendingDigest.pop_front();
+    }
+    pendingCount++;
+
+    if (digestInterval == 0) {
+        flushDigestLocked();
+    }
+}
+
+void TechnicianNotificationObserver::onTick(std::time_t now) {
+    std::lock_guard<std::mutex> lock(digestMutex);
+
+    if (now - digestWindowStart >= digestInterval) {
+        flushDigestLocked();
+    }
+}
+
+size_t TechnicianNotificationObserver::flushDigest() {
+    std::lock_guard<std::mutex> lock(digestMutex);
+    return flushDigestLocked();
+}
+
+size_t TechnicianNotificationObserver::flushDigestLocked() {
+    digestWindowStart = std::time(nullptr);
+
+    size_t count = pendingCount;
+    if (count == 0 || !notificationSystem) {
+        return 0;
+    }
+
+    if (count == 1) {
+        notificationSystem->broadcastNotification("General notification: " + pendingDigest.front());
     } else {
-        // If no specific technician found, broadcast to all
-        notificationSystem->broadcastNotification("General notification: " + message);
+        // Summarize the window, listing only the most recent messages
+        std::ostringstream digest;
+        digest << "General notification digest (" << count << " events";
+        if (count > pendingDigest.size()) {
+            digest << ", " << count - pendingDigest.size() << " older not shown";
+        }
+        digest << "):";
+        for (const auto& message : pendingDigest) {
+            digest << std::endl << "- " << message;
+        }
+        notificationSystem->broadcastNotification(digest.str());
     }
-}
\ No newline at end of file
+
+    pendingDigest.clear();
+    pendingCount = 0;
+    return count;
+}
+
+size_t TechnicianNotificationObserver::getPendingDigestSize() const {
+    std::lock_guard<std::mutex> lock(digestMutex);
+    return pendingCount;
+}
@@ -0,0 +1,130 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Proxy/AccessAuditLog.h"
+#include <fstream>
+#include <iostream>
+
+AccessAuditLog::AccessAuditLog(const std::string& filename, size_t bufferSize, int flushIntervalSeconds)
+    : filename(filename),
+      bufferSize(bufferSize == 0 ? 1 : bufferSize),
+      flushIntervalSeconds(flushIntervalSeconds),
+      grantSampling(1),
+      logDenials(true),
+      echoDenials(true),
+      grantCounter(0),
+      sampledOut(0) {
+    buffer.reserve(this->bufferSize);
+}
+
+AccessAuditLog::~AccessAuditLog() {
+    flush();
+}
+
+void AccessAuditLog::record(const std::string& userId, const char* operation, bool granted) {
+    if (granted) {
+        // Sampling is decided without the lock
+        unsigned interval = grantSampling.load(std::memory_order_relaxed);
+        if (interval == 0 || grantCounter.fetch_add(1, std::memory_order_relaxed) % interval != 0) {
+            sampledOut.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    } else {
+        if (!logDenials.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (echoDenials.load(std::memory_order_relaxed)) {
+            std::cout << "log [ACCESS] User '" << userId << "' attempted '" << operation << "' - DENIED" << std::endl;
+        }
+    }
+
+    std::time_t now = std::time(nullptr);
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    buffer.push_back(Entry{now, userId, operation, granted});
+
+    if (buffer.size() >= bufferSize || now - buffer.front().time >= flushIntervalSeconds) {
+        flushLocked();
+    }
+}
+
+void AccessAuditLog::flush() {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    flushLocked();
+}
+
+void AccessAuditLog::flushIfDue(std::time_t now) {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    if (!buffer.empty() && now - buffer.front().time >= flushIntervalSeconds) {
+        flushLocked();
+    }
+}
+
+void AccessAuditLog::flushLocked() {
+    if (buffer.empty()) {
+        return;
+    }
+
+    std::ofstream logFile(filename, std::ios::app);
+    if (logFile.is_open()) {
+        // Entries arrive in order: format each distinct second once
+        std::time_t formatted = -1;
+        char timestamp[25] = "";
+        for (const auto& entry : buffer) {
+            if (entry.time != formatted) {
+                // std::localtime shares its result between threads
+                std::tm local{};
+#ifdef WINDOWS_PLATFORM
+                localtime_s(&local, &entry.time);
+#else
+                localtime_r(&entry.time, &local);
+#endif
+                std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &local);
+                formatted = entry.time;
+            }
+            logFile << "[" << timestamp << "] User '" << entry.userId
+                    << "' attempted '" << entry.operation << "' - "
+                    << (entry.granted ? "GRANTED" : "DENIED") << '\n';
+        }
+    }
+
+    buffer.clear();
+}
+
+void AccessAuditLog::setGrantSampling(unsigned interval) {
+    grantSampling.store(interval, std::memory_order_relaxed);
+}
+
+void AccessAuditLog::setLogDenials(bool enabled) {
+    logDenials.store(enabled, std::memory_order_relaxed);
+}
+
+void AccessAuditLog::setEchoDenials(bool enabled) {
+    echoDenials.store(enabled, std::memory_order_relaxed);
+}
+
+size_t AccessAuditLog::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    return buffer.size();
+}
+
+std::uint64_t AccessAuditLog::getSampledOutCount() const {
+    return sampledOut.load(std::memory_order_relaxed);
+}
+
+AuditLogFlusher::AuditLogFlusher(std::shared_ptr<AccessAuditLog> log)
+    : log(std::move(log)) {
+}
+
+void AuditLogFlusher::notify(const std::string& message) {
+    (void)message; // Only the tick matters
+}
+
+bool AuditLogFlusher::isInterestedIn(const std::string& eventType) const {
+    (void)eventType;
+    return false;
+}
+
+void AuditLogFlusher::onTick(std::time_t now) {
+    log->flushIfDue(now);
+}
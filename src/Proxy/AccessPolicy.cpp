@@ -0,0 +1,251 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Proxy/AccessPolicy.h"
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+std::vector<std::string> split(const std::string& text, char separator) {
+    std::vector<std::string> parts;
+    std::istringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, separator)) {
+        if (!part.empty()) {
+            parts.push_back(part);
+        }
+    }
+    return parts;
+}
+
+} // namespace
+
+AccessPolicy AccessPolicy::createDefault() {
+    AccessPolicy policy;
+
+    policy.defineRole("admin", FULL_OPERATIONS);
+    policy.defineRole("manager", MODIFY_OPERATIONS);
+    policy.defineRole("guest", READ_OPERATIONS);
+
+    // Technicians report on their own jobs without being able to modify them
+    const std::uint32_t own = CapabilityToken::bit(Operation::CHANGE_INTERVENTION_STATUS) |
+                              CapabilityToken::bit(Operation::ADD_GPS_COORDINATE) |
+                              CapabilityToken::bit(Operation::ADD_GPS_COORDINATES) |
+                              CapabilityToken::bit(Operation::ADD_ATTACHMENT);
+    policy.defineRole("technician", READ_OPERATIONS | own, own);
+
+    for (const char* user : {"admin", "manager", "technician", "guest"}) {
+        policy.bindUser(user, user);
+    }
+
+    return policy;
+}
+
+bool AccessPolicy::findOperation(std::string_view name, Operation& operation) {
+    for (size_t i = 0; i < static_cast<size_t>(Operation::COUNT); i++) {
+        if (name == CapabilityToken::getOperationName(static_cast<Operation>(i))) {
+            operation = static_cast<Operation>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AccessPolicy::parseOperations(const std::string& list, std::uint32_t& operations, std::uint32_t& ownOnly) {
+    operations = 0;
+    ownOnly = 0;
+
+    for (const auto& item : split(list, ',')) {
+        std::string_view name = item;
+        bool own = false;
+        if (name.size() > 4 && name.substr(name.size() - 4) == ":own") {
+            name.remove_suffix(4);
+            own = true;
+        }
+
+        std::uint32_t mask;
+        Operation operation;
+        if (name == "*") {
+            mask = FULL_OPERATIONS;
+        } else if (findOperation(name, operation)) {
+            mask = CapabilityToken::bit(operation);
+        } else {
+            return false;
+        }
+
+        operations |= mask;
+        if (own) {
+            ownOnly |= mask;
+        }
+    }
+
+    return true;
+}
+
+void AccessPolicy::defineRole(const std::string& name, std::uint32_t operations, std::uint32_t ownOnly) {
+    roles[name] = Role{operations, ownOnly & operations};
+}
+
+bool AccessPolicy::hasRole(const std::string& name) const {
+    return roles.find(name) != roles.end();
+}
+
+int AccessPolicy::defineRegion(const std::string& name) {
+    for (size_t i = 0; i < regionNames.size(); i++) {
+        if (regionNames[i] == name) {
+            return static_cast<int>(i);
+        }
+    }
+
+    if (regionNames.size() >= MAX_REGIONS) {
+        return -1;
+    }
+
+    regionNames.push_back(name);
+    return static_cast<int>(regionNames.size() - 1);
+}
+
+AccessPolicy::RegionMask AccessPolicy::getRegionMask(const std::vector<std::string>& names) const {
+    RegionMask mask = 0;
+    for (const auto& name : names) {
+        size_t i = 0;
+        while (i < regionNames.size() && regionNames[i] != name) {
+            i++;
+        }
+        if (i == regionNames.size()) {
+            return 0;
+        }
+        mask |= RegionMask(1) << i;
+    }
+    return mask;
+}
+
+bool AccessPolicy::addLocation(const std::string& region, const std::string& location) {
+    int bit = defineRegion(region);
+    if (bit < 0 || location.empty()) {
+        return false;
+    }
+
+    locationRegions[location] |= RegionMask(1) << bit;
+    return true;
+}
+
+AccessPolicy::RegionMask AccessPolicy::getLocationRegions(std::string_view location) const {
+    auto it = locationRegions.find(location);
+    return it != locationRegions.end() ? it->second : 0;
+}
+
+bool AccessPolicy::bindUser(const std::string& userId, const std::string& role,
+                            RegionMask regions, const std::string& technicianId) {
+    if (!hasRole(role)) {
+        return false;
+    }
+
+    bindings[userId] = Binding{role, regions, technicianId};
+    return true;
+}
+
+int AccessPolicy::load(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return -1;
+    }
+
+    int loaded = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        // Skip blank lines and comments
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::vector<std::string> fields = split(line, ';');
+        if (fields.size() < 3) {
+            continue;
+        }
+
+        if (fields[0] == "role") {
+            std::uint32_t operations, ownOnly;
+            if (!parseOperations(fields[2], operations, ownOnly)) {
+                continue; // Unknown operation
+            }
+            defineRole(fields[1], operations, ownOnly);
+            loaded++;
+        } else if (fields[0] == "region") {
+            bool added = fields.size() > 2;
+            for (size_t i = 2; i < fields.size(); i++) {
+                added = addLocation(fields[1], fields[i]) && added;
+            }
+            if (added) {
+                loaded++;
+            }
+        } else if (fields[0] == "user") {
+            RegionMask regions = CapabilityToken::ALL_REGIONS;
+            if (fields.size() > 3 && fields[3] != "*") {
+                regions = getRegionMask(split(fields[3], ','));
+                if (regions == 0) {
+                    continue; // Unknown region
+                }
+            }
+            if (bindUser(fields[1], fields[2], regions, fields.size() > 4 ? fields[4] : "")) {
+                loaded++;
+            }
+        }
+    }
+
+    return loaded;
+}
+
+CapabilityToken AccessPolicy::resolve(const std::string& userId, const std::string& role) const {
+    auto binding = bindings.find(userId);
+    if (binding != bindings.end()) {
+        const Role& bound = roles.at(binding->second.role);
+        std::uint32_t operations = bound.operations;
+
+        // The real manager bypasses every check: never hand it to a user limited to regions
+        if (binding->second.regions != CapabilityToken::ALL_REGIONS) {
+            operations &= ~CapabilityToken::bit(Operation::GET_REAL_MANAGER);
+        }
+
+        return CapabilityToken(userId, operations, bound.ownOnly, binding->second.regions,
+                               binding->second.technicianId);
+    }
+
+    auto it = roles.find(role);
+    if (it != roles.end()) {
+        return CapabilityToken(userId, it->second.operations, it->second.ownOnly);
+    }
+
+    return CapabilityToken(userId, 0);
+}
+
+std::string AccessPolicy::describe(const CapabilityToken& token) const {
+    std::ostringstream description;
+
+    description << "User " << token.getUserId() << " (technician ID " << token.getTechnicianId() << ")\n";
+    description << "Operations:";
+    for (size_t i = 0; i < static_cast<size_t>(Operation::COUNT); i++) {
+        auto operation = static_cast<Operation>(i);
+        if (token.allows(operation)) {
+            description << " " << CapabilityToken::getOperationName(operation);
+            if (token.getOwnOnly() & CapabilityToken::bit(operation)) {
+                description << "(own)";
+            }
+        }
+    }
+
+    description << "\nRegions:";
+    if (token.getRegions() == CapabilityToken::ALL_REGIONS) {
+        description << " all";
+    } else {
+        for (size_t i = 0; i < regionNames.size(); i++) {
+            if (token.getRegions() & (RegionMask(1) << i)) {
+                description << " " << regionNames[i];
+            }
+        }
+    }
+
+    return description.str();
+}
@@ -3,34 +3,119 @@
 //
 
 #include "Proxy/InterventionManagerSecure.h"
-#include <iostream>
-#include <fstream>
-#include <ctime>
+
+using Operation = CapabilityToken::Operation;
+
 
 InterventionManagerSecure::InterventionManagerSecure(const std::string& currentUser)
-    : realManager(std::make_unique<InterventionManager>()), currentUser(currentUser) {
+    : InterventionManagerSecure(currentUser, std::make_shared<const AccessPolicy>(AccessPolicy::createDefault())) {
+}
+
+InterventionManagerSecure::InterventionManagerSecure(const std::string& currentUser,
+                                                     std::shared_ptr<const AccessPolicy> policy,
+                                                     const std::string& role)
+    : InterventionManagerSecure(currentUser, std::make_shared<InterventionManager>(), std::move(policy), role) {
+}
+
+InterventionManagerSecure::InterventionManagerSecure(const std::string& currentUser,
+                                                     std::shared_ptr<InterventionManager> manager,
+                                                     std::shared_ptr<const AccessPolicy> policy,
+                                                     const std::string& role)
+    : realManager(std::move(manager)),
+      currentUser(currentUser),
+      policy(policy ? std::move(policy) : std::make_shared<const AccessPolicy>()),
+      token(currentUser, 0),
+      auditLog(std::make_shared<AccessAuditLog>()) {
+
+    // Resolve the user's permissions once; unknown users get no access
+    token = this->policy->resolve(currentUser, role);
+
+    // The log is the proxy's own until setAuditLog() shares another one
+    auditFlusher = std::make_shared<AuditLogFlusher>(auditLog);
+    realManager->addObserver(auditFlusher);
+}
+
+InterventionManagerSecure::~InterventionManagerSecure() {
+    if (auditFlusher) {
+        realManager->removeObserver(auditFlusher.get());
+    }
+}
+
+std::uint32_t InterventionManagerSecure::operationsFor(AccessLevel level) {
+    switch (level) {
+        case AccessLevel::FULL:
+            return AccessPolicy::FULL_OPERATIONS;
+        case AccessLevel::MODIFY:
+            return AccessPolicy::MODIFY_OPERATIONS;
+        case AccessLevel::READ:
+            return AccessPolicy::READ_OPERATIONS;
+        default:
+            return 0;
+    }
+}
+
+bool InterventionManagerSecure::allowsOn(CapabilityToken::Operation operation, const Intervention& target) const {
+    // The location is only looked up for users limited to regions
+    CapabilityToken::RegionMask regions = token.getRegions() == CapabilityToken::ALL_REGIONS
+                                              ? CapabilityToken::ALL_REGIONS
+                                              : policy->getLocationRegions(target.getLocationView());
+    return token.allowsOn(operation, target.getTechnicianIdView(), regions);
+}
+
+bool InterventionManagerSecure::authorize(CapabilityToken::Operation operation) const {
+    bool granted = token.allows(operation);
+    auditLog->record(token.getUserId(), CapabilityToken::getOperationName(operation), granted);
+    return granted;
+}
+
+bool InterventionManagerSecure::authorize(CapabilityToken::Operation operation, int interventionId) const {
+    bool granted = token.allows(operation);
+    if (granted && token.isScoped(operation)) {
+        const Intervention* target = realManager->getIntervention(interventionId);
+        granted = target != nullptr && allowsOn(operation, *target);
+    }
+    auditLog->record(token.getUserId(), CapabilityToken::getOperationName(operation), granted);
+    return granted;
+}
+
+bool InterventionManagerSecure::authorizeAt(CapabilityToken::Operation operation, const std::string& location) const {
+    bool granted = token.allows(operation);
+    if (granted && token.isScoped(operation)) {
+        // Nothing is owned yet: only the regions matter
+        granted = token.allowsOn(operation, token.getTechnicianId(), policy->getLocationRegions(location));
+    }
+    auditLog->record(token.getUserId(), CapabilityToken::getOperationName(operation), granted);
+    return granted;
+}
 
-    // Initialize default access levels (in a real app, this would come from a database)
-    userAccessLevels["admin"] = AccessLevel::FULL;
-    userAccessLevels["manager"] = AccessLevel::MODIFY;
-    userAccessLevels["technician"] = AccessLevel::READ;
-    userAccessLevels["guest"] = AccessLevel::READ;
+bool InterventionManagerSecure::authorizeGlobal(CapabilityToken::Operation operation) const {
+    bool granted = token.allows(operation) && !token.isScoped(operation);
+    auditLog->record(token.getUserId(), CapabilityToken::getOperationName(operation), granted);
+    return granted;
+}
 
-    // If the user doesn't exist, set their access level to NONE
-    if (userAccessLevels.find(currentUser) == userAccessLevels.end()) {
-        userAccessLevels[currentUser] = AccessLevel::NONE;
+bool InterventionManagerSecure::authorizeSeries(CapabilityToken::Operation operation, int seriesId) const {
+    bool granted = token.allows(operation);
+    if (granted && token.isScoped(operation)) {
+        const Intervention* prototype = realManager->getRecurrences().getPrototype(seriesId);
+        granted = prototype != nullptr && allowsOn(operation, *prototype);
     }
+    auditLog->record(token.getUserId(), CapabilityToken::getOperationName(operation), granted);
+    return granted;
 }
 
 void InterventionManagerSecure::setUserAccessLevel(const std::string& userId, AccessLevel level) {
     // Only admin can change access levels
-    if (getCurrentUserAccessLevel() != AccessLevel::FULL) {
-        logAccessAttempt("setUserAccessLevel", false);
+    if (!authorize(Operation::SET_USER_ACCESS_LEVEL)) {
         return;
     }
 
     userAccessLevels[userId] = level;
-    logAccessAttempt("setUserAccessLevel", true);
+
+    // The current user's permissions changed: resolve a new token
+    if (userId == currentUser) {
+        token = CapabilityToken(currentUser, operationsFor(level));
+    }
 }
 
 InterventionManagerSecure::AccessLevel InterventionManagerSecure::getCurrentUserAccessLevel() const {
@@ -38,59 +123,74 @@ InterventionManagerSecure::AccessLevel InterventionManagerSecure::getCurrentUser
     if (it != userAccessLevels.end()) {
         return it->second;
     }
+
+    // Highest level whose operations the token grants without restriction
+    std::uint32_t unrestricted = token.getRegions() == CapabilityToken::ALL_REGIONS
+                                     ? token.getPermitted() & ~token.getOwnOnly()
+                                     : 0;
+    for (AccessLevel level : {AccessLevel::FULL, AccessLevel::MODIFY, AccessLevel::READ}) {
+        if ((unrestricted & operationsFor(level)) == operationsFor(level)) {
+            return level;
+        }
+    }
     return AccessLevel::NONE;
 }
 
-bool InterventionManagerSecure::checkAccess(AccessLevel requiredLevel) const {
-    AccessLevel userLevel = getCurrentUserAccessLevel();
-
-    // Convert enum to int for comparison
-    return static_cast<int>(userLevel) >= static_cast<int>(requiredLevel);
+const CapabilityToken& InterventionManagerSecure::getToken() const {
+    return token;
 }
 
-void InterventionManagerSecure::logAccessAttempt(const std::string& operation, bool granted) const {
-    // Generate timestamp
-    std::time_t now = std::time(nullptr);
-    char timestamp[25];
-    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
-
-    // Log to console
-    std::cout << "log [ACCESS] [" << timestamp << "] User '" << currentUser
-              << "' attempted '" << operation << "' - "
-              << (granted ? "GRANTED" : "DENIED") << std::endl;
+void InterventionManagerSecure::setAuditLog(std::shared_ptr<AccessAuditLog> log) {
+    if (log && log != auditLog) {
+        auditLog = std::move(log);
 
-    // In a real application, this could also log to a file or database
-    std::ofstream logFile("access_log.txt", std::ios::app);
-    if (logFile.is_open()) {
-        logFile << "[" << timestamp << "] User '" << currentUser
-                << "' attempted '" << operation << "' - "
-                << (granted ? "GRANTED" : "DENIED") << std::endl;
-        logFile.close();
+        // A shared log is flushed once by its owner, not by each proxy
+        if (auditFlusher) {
+            realManager->removeObserver(auditFlusher.get());
+            auditFlusher.reset();
+        }
     }
 }
 
+std::shared_ptr<const AccessPolicy> InterventionManagerSecure::getPolicy() const {
+    return policy;
+}
+
+std::shared_ptr<AccessAuditLog> InterventionManagerSecure::getAuditLog() const {
+    return auditLog;
+}
+
 // IInterventionManager interface implementation
 
 int InterventionManagerSecure::createIntervention(const std::string& type,
                                                const std::string& location,
                                                std::time_t date,
                                                int duration) {
-    if (!checkAccess(AccessLevel::FULL)) {
-        logAccessAttempt("createIntervention", false);
+    if (!authorizeAt(Operation::CREATE_INTERVENTION, location)) {
         return -1;
     }
 
-    logAccessAttempt("createIntervention", true);
     return realManager->createIntervention(type, location, date, duration);
 }
 
+int InterventionManagerSecure::createEmergencyIntervention(const std::string& location,
+                                                        std::time_t date,
+                                                        int duration,
+                                                        int priority,
+                                                        const std::string& specialty) {
+    if (!authorizeAt(Operation::CREATE_EMERGENCY_INTERVENTION, location)) {
+        return -1;
+    }
+
+    return realManager->createEmergencyIntervention(location, date, duration, priority, specialty);
+}
+
 bool InterventionManagerSecure::deleteIntervention(int interventionId) {
-    if (!checkAccess(AccessLevel::FULL)) {
-        logAccessAttempt("deleteIntervention", false);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::DELETE_INTERVENTION, interventionId)) {
         return false;
     }
 
-    logAccessAttempt("deleteIntervention", true);
     return realManager->deleteIntervention(interventionId);
 }
 
@@ -98,116 +198,414 @@ bool InterventionManagerSecure::modifyIntervention(int interventionId,
                                                 const std::string& location,
                                                 std::time_t date,
                                                 int duration) {
-    if (!checkAccess(AccessLevel::MODIFY)) {
-        logAccessAttempt("modifyIntervention", false);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    // Moving an intervention in a region needs the rights at the new location as well
+    if (!authorize(Operation::MODIFY_INTERVENTION, interventionId) ||
+        (!location.empty() && token.isScoped(Operation::MODIFY_INTERVENTION) &&
+         !authorizeAt(Operation::MODIFY_INTERVENTION, location))) {
         return false;
     }
 
-    logAccessAttempt("modifyIntervention", true);
     return realManager->modifyIntervention(interventionId, location, date, duration);
 }
 
 bool InterventionManagerSecure::changeInterventionStatus(int interventionId,
                                                       const std::string& status,
                                                       const std::string& comments) {
-    if (!checkAccess(AccessLevel::MODIFY)) {
-        logAccessAttempt("changeInterventionStatus", false);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::CHANGE_INTERVENTION_STATUS, interventionId)) {
         return false;
     }
 
-    logAccessAttempt("changeInterventionStatus", true);
     return realManager->changeInterventionStatus(interventionId, status, comments);
 }
 
 bool InterventionManagerSecure::assignTechnician(int interventionId,
                                               const std::string& technicianId) {
-    if (!checkAccess(AccessLevel::MODIFY)) {
-        logAccessAttempt("assignTechnician", false);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::ASSIGN_TECHNICIAN, interventionId)) {
         return false;
     }
 
-    logAccessAttempt("assignTechnician", true);
     return realManager->assignTechnician(interventionId, technicianId);
 }
 
 const Intervention* InterventionManagerSecure::getIntervention(int interventionId) const {
-    if (!checkAccess(AccessLevel::READ)) {
-        logAccessAttempt("getIntervention", false);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::GET_INTERVENTION, interventionId)) {
         return nullptr;
     }
 
-    logAccessAttempt("getIntervention", true);
     return realManager->getIntervention(interventionId);
 }
 
+std::string InterventionManagerSecure::getInterventionInfo(int interventionId) const {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::GET_INTERVENTION_INFO, interventionId)) {
+        return "";
+    }
+
+    return realManager->getInterventionInfo(interventionId);
+}
+
 std::vector<const Intervention*> InterventionManagerSecure::getInterventionsForDay(std::time_t date) const {
-    if (!checkAccess(AccessLevel::READ)) {
-        logAccessAttempt("getInterventionsForDay", false);
+    if (!authorize(Operation::GET_INTERVENTIONS_FOR_DAY)) {
         return std::vector<const Intervention*>();
     }
 
-    logAccessAttempt("getInterventionsForDay", true);
-    return realManager->getInterventionsForDay(date);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    std::vector<const Intervention*> interventions = realManager->getInterventionsForDay(date);
+    if (token.isScoped(Operation::GET_INTERVENTIONS_FOR_DAY)) {
+        // Only the interventions the user may see
+        std::vector<const Intervention*> visible;
+        for (const Intervention* intervention : interventions) {
+            if (allowsOn(Operation::GET_INTERVENTIONS_FOR_DAY, *intervention)) {
+                visible.push_back(intervention);
+            }
+        }
+        return visible;
+    }
+    return interventions;
 }
 
 std::map<int, int> InterventionManagerSecure::getInterventionCountsForMonth(int month, int year) const {
-    if (!checkAccess(AccessLevel::READ)) {
-        logAccessAttempt("getInterventionCountsForMonth", false);
+    if (!authorize(Operation::GET_INTERVENTION_COUNTS_FOR_MONTH)) {
         return std::map<int, int>();
     }
 
-    logAccessAttempt("getInterventionCountsForMonth", true);
-    return realManager->getInterventionCountsForMonth(month, year);
+    if (!token.isScoped(Operation::GET_INTERVENTION_COUNTS_FOR_MONTH)) {
+        return realManager->getInterventionCountsForMonth(month, year);
+    }
+
+    // Count only the interventions the user may see, day by day
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    std::map<int, int> counts;
+    std::tm day = {};
+    day.tm_year = year - 1900;
+    day.tm_mon = month - 1;
+    for (int dayOfMonth = 1; dayOfMonth <= 31; dayOfMonth++) {
+        day.tm_mday = dayOfMonth;
+        day.tm_hour = 12; // Away from daylight saving changes
+        day.tm_min = 0;
+        day.tm_sec = 0;
+        day.tm_isdst = -1;
+        std::time_t noon = std::mktime(&day);
+        if (noon == -1 || day.tm_mon != month - 1) {
+            break; // Past the end of the month
+        }
+
+        int visible = 0;
+        for (const Intervention* intervention : realManager->getInterventionsForDay(noon)) {
+            if (allowsOn(Operation::GET_INTERVENTION_COUNTS_FOR_MONTH, *intervention)) {
+                visible++;
+            }
+        }
+        counts[dayOfMonth] = visible;
+    }
+    return counts;
 }
 
 InterventionManager* InterventionManagerSecure::getRealManager() const {
-    // Optionally, you could add a security check here to ensure only admin users
-    // can access the real manager directly
-    if (getCurrentUserAccessLevel() != AccessLevel::FULL) {
-        logAccessAttempt("getRealManager", false);
+    // Only admin users can access the real manager directly
+    if (!authorize(Operation::GET_REAL_MANAGER)) {
         return nullptr;
     }
 
-    logAccessAttempt("getRealManager", true);
     return realManager.get();
 }
 
 bool InterventionManagerSecure::decorateWithGPS(int interventionId) {
-    if (!checkAccess(AccessLevel::MODIFY)) {
-        logAccessAttempt("decorateWithGPS", false);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::DECORATE_WITH_GPS, interventionId)) {
         return false;
     }
 
-    logAccessAttempt("decorateWithGPS", true);
     return realManager->decorateWithGPS(interventionId);
 }
 
 bool InterventionManagerSecure::decorateWithAttachments(int interventionId) {
-    if (!checkAccess(AccessLevel::MODIFY)) {
-        logAccessAttempt("decorateWithAttachments", false);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::DECORATE_WITH_ATTACHMENTS, interventionId)) {
         return false;
     }
 
-    logAccessAttempt("decorateWithAttachments", true);
     return realManager->decorateWithAttachments(interventionId);
 }
 
 bool InterventionManagerSecure::addGPSCoordinate(int interventionId, double latitude, double longitude) {
-    if (!checkAccess(AccessLevel::MODIFY)) {
-        logAccessAttempt("addGPSCoordinate", false);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::ADD_GPS_COORDINATE, interventionId)) {
         return false;
     }
 
-    logAccessAttempt("addGPSCoordinate", true);
     return realManager->addGPSCoordinate(interventionId, latitude, longitude);
 }
 
+size_t InterventionManagerSecure::addGPSCoordinates(const std::vector<GPSSample>& samples) {
+    // One check and one log entry for the whole batch
+    if (!authorize(Operation::ADD_GPS_COORDINATES)) {
+        return 0;
+    }
+
+    if (token.isScoped(Operation::ADD_GPS_COORDINATES)) {
+        // Keep the samples of the interventions the user may report on
+        std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+        std::vector<GPSSample> permitted;
+        permitted.reserve(samples.size());
+        for (const auto& sample : samples) {
+            const Intervention* target = realManager->getIntervention(sample.interventionId);
+            if (target != nullptr && allowsOn(Operation::ADD_GPS_COORDINATES, *target)) {
+                permitted.push_back(sample);
+            }
+        }
+        return realManager->addGPSCoordinates(permitted);
+    }
+
+    return realManager->addGPSCoordinates(samples);
+}
+
 bool InterventionManagerSecure::addAttachment(int interventionId, const std::string& filename, const std::string& description) {
-    if (!checkAccess(AccessLevel::MODIFY)) {
-        logAccessAttempt("addAttachment", false);
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::ADD_ATTACHMENT, interventionId)) {
         return false;
     }
 
-    logAccessAttempt("addAttachment", true);
     return realManager->addAttachment(interventionId, filename, description);
-}
\ No newline at end of file
+}
+
+DispatchProposal InterventionManagerSecure::proposeDispatch(bool allowPreemption) const {
+    // The queue spans every region
+    if (!authorizeGlobal(Operation::PROPOSE_DISPATCH)) {
+        return DispatchProposal();
+    }
+
+    return realManager->proposeDispatch(allowPreemption);
+}
+
+bool InterventionManagerSecure::dispatchNextEmergency(bool allowPreemption) {
+    if (!authorizeGlobal(Operation::DISPATCH_EMERGENCY)) {
+        return false;
+    }
+
+    return realManager->dispatchNextEmergency(allowPreemption);
+}
+
+size_t InterventionManagerSecure::getDispatchQueueSize() const {
+    if (!authorizeGlobal(Operation::PROPOSE_DISPATCH)) {
+        return 0;
+    }
+
+    return realManager->getDispatchQueueSize();
+}
+
+AutoAssignReport InterventionManagerSecure::autoAssignTechnicians(bool greedy, int maxRounds) {
+    // Assigns the unassigned interventions of every region
+    if (!authorizeGlobal(Operation::AUTO_ASSIGN_TECHNICIANS)) {
+        return AutoAssignReport();
+    }
+
+    return realManager->autoAssignTechnicians(greedy, maxRounds);
+}
+
+std::vector<TechnicianManager::SlotOption> InterventionManagerSecure::findEarliestSlots(int duration,
+                                                                                       const std::string& specialty,
+                                                                                       std::time_t notBefore,
+                                                                                       std::time_t horizon,
+                                                                                       size_t count) const {
+    if (!authorize(Operation::FIND_FREE_SLOTS)) {
+        return std::vector<TechnicianManager::SlotOption>();
+    }
+
+    return realManager->findEarliestSlots(duration, specialty, notBefore, horizon, count);
+}
+
+bool InterventionManagerSecure::addShiftEntry(const std::string& technicianId, ShiftCalendar::EntryKind kind,
+                                              std::time_t start, std::time_t end) {
+    if (!authorize(Operation::EDIT_SHIFT_CALENDAR)) {
+        return false;
+    }
+
+    return realManager->addShiftEntry(technicianId, kind, start, end);
+}
+
+int InterventionManagerSecure::getAvailableMinutes(const std::string& technicianId, std::time_t from,
+                                                   std::time_t to) const {
+    if (!authorize(Operation::FIND_FREE_SLOTS)) {
+        return -1;
+    }
+
+    return realManager->getAvailableMinutes(technicianId, from, to);
+}
+
+int InterventionManagerSecure::loadGazetteer(const std::string& filename) {
+    // Locations are shared by every region
+    if (!authorizeGlobal(Operation::LOAD_LOCATIONS)) {
+        return -1;
+    }
+
+    return realManager->loadGazetteer(filename);
+}
+
+int InterventionManagerSecure::resolveLocationsFromTracking() {
+    if (!authorizeGlobal(Operation::LOAD_LOCATIONS)) {
+        return 0;
+    }
+
+    return realManager->resolveLocationsFromTracking();
+}
+
+double InterventionManagerSecure::getTravelMinutes(int fromInterventionId, int toInterventionId) {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::GET_TRAVEL_MINUTES, fromInterventionId) ||
+        !authorize(Operation::GET_TRAVEL_MINUTES, toInterventionId)) {
+        return -1;
+    }
+
+    return realManager->getTravelMinutes(fromInterventionId, toInterventionId);
+}
+
+bool InterventionManagerSecure::getTrackSummary(int interventionId, TrackAnalytics::Summary& summary,
+                                                double siteRadiusKm) {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::GET_TRACK, interventionId)) {
+        return false;
+    }
+
+    return realManager->getTrackSummary(interventionId, summary, siteRadiusKm);
+}
+
+bool InterventionManagerSecure::getTrackPoints(int interventionId, size_t budget,
+                                               std::vector<GPSTrackingComponent::GPSCoordinate>& points) {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::GET_TRACK, interventionId)) {
+        return false;
+    }
+
+    return realManager->getTrackPoints(interventionId, budget, points);
+}
+
+bool InterventionManagerSecure::setSiteCoordinates(int interventionId, double latitude, double longitude) {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::SET_SITE_COORDINATES, interventionId)) {
+        return false;
+    }
+
+    return realManager->setSiteCoordinates(interventionId, latitude, longitude);
+}
+
+std::vector<std::pair<int, double>> InterventionManagerSecure::findInterventionsWithin(double latitude,
+                                                                                       double longitude,
+                                                                                       double radiusKm) const {
+    if (!authorize(Operation::FIND_NEARBY)) {
+        return std::vector<std::pair<int, double>>();
+    }
+
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    std::vector<std::pair<int, double>> sites = realManager->findInterventionsWithin(latitude, longitude, radiusKm);
+    if (token.isScoped(Operation::FIND_NEARBY)) {
+        // Only the interventions the user may see, still nearest first
+        std::vector<std::pair<int, double>> visible;
+        for (const auto& site : sites) {
+            const Intervention* intervention = realManager->getIntervention(site.first);
+            if (intervention != nullptr && allowsOn(Operation::FIND_NEARBY, *intervention)) {
+                visible.push_back(site);
+            }
+        }
+        return visible;
+    }
+    return sites;
+}
+
+std::vector<std::pair<std::string, double>> InterventionManagerSecure::findNearestTechnicians(double latitude,
+                                                                                              double longitude,
+                                                                                              size_t count) const {
+    if (!authorize(Operation::FIND_NEARBY)) {
+        return std::vector<std::pair<std::string, double>>();
+    }
+
+    return realManager->findNearestTechnicians(latitude, longitude, count);
+}
+
+bool InterventionManagerSecure::setGeofenceRadius(int interventionId, double radiusKm) {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorize(Operation::SET_GEOFENCE, interventionId)) {
+        return false;
+    }
+
+    return realManager->setGeofenceRadius(interventionId, radiusKm);
+}
+
+bool InterventionManagerSecure::setGeofenceAutoStatus(bool startOnArrival, bool completeOnDeparture) {
+    // Applies to the geofences of every region
+    if (!authorizeGlobal(Operation::SET_GEOFENCE)) {
+        return false;
+    }
+
+    return realManager->setGeofenceAutoStatus(startOnArrival, completeOnDeparture);
+}
+
+int InterventionManagerSecure::createRecurringIntervention(const std::string& type, const std::string& location,
+                                                           std::time_t start, int duration,
+                                                           const RecurrenceRule& rule) {
+    if (!authorizeAt(Operation::MANAGE_RECURRENCES, location)) {
+        return -1;
+    }
+
+    return realManager->createRecurringIntervention(type, location, start, duration, rule);
+}
+
+bool InterventionManagerSecure::deleteRecurringSeries(int seriesId) {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorizeSeries(Operation::MANAGE_RECURRENCES, seriesId)) {
+        return false;
+    }
+
+    return realManager->deleteRecurringSeries(seriesId);
+}
+
+bool InterventionManagerSecure::cancelOccurrence(int seriesId, int index) {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorizeSeries(Operation::MANAGE_RECURRENCES, seriesId)) {
+        return false;
+    }
+
+    return realManager->cancelOccurrence(seriesId, index);
+}
+
+bool InterventionManagerSecure::moveOccurrence(int seriesId, int index, std::time_t date) {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorizeSeries(Operation::MANAGE_RECURRENCES, seriesId)) {
+        return false;
+    }
+
+    return realManager->moveOccurrence(seriesId, index, date);
+}
+
+bool InterventionManagerSecure::setRecurrenceHorizon(int days) {
+    // Applies to the series of every region
+    if (!authorizeGlobal(Operation::MANAGE_RECURRENCES)) {
+        return false;
+    }
+
+    return realManager->setRecurrenceHorizon(days);
+}
+
+std::string InterventionManagerSecure::getRecurringSeriesInfo(int seriesId) const {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorizeSeries(Operation::GET_RECURRENCES, seriesId)) {
+        return "";
+    }
+
+    return realManager->getRecurringSeriesInfo(seriesId);
+}
+
+std::vector<RecurrenceEngine::Occurrence> InterventionManagerSecure::getPendingOccurrences(int seriesId,
+                                                                                          std::time_t from,
+                                                                                          std::time_t to) const {
+    std::unique_lock<std::recursive_mutex> lock = realManager->lockState();
+    if (!authorizeSeries(Operation::GET_RECURRENCES, seriesId)) {
+        return std::vector<RecurrenceEngine::Occurrence>();
+    }
+
+    return realManager->getPendingOccurrences(seriesId, from, to);
+}
@@ -0,0 +1,649 @@
+//
+// Created by Léo KRYS on 18/10/2026.
+//
+
+#include "Server/InterventionDaemon.h"
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sstream>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+// Split a request on spaces, double quotes grouping words
+std::vector<std::string> tokenize(const std::string& request) {
+    std::vector<std::string> tokens;
+    std::string token;
+    bool quoted = false;
+    bool started = false;
+
+    for (char c : request) {
+        if (c == '"') {
+            quoted = !quoted;
+            started = true;
+        } else if (c == ' ' && !quoted) {
+            if (started) {
+                tokens.push_back(token);
+                token.clear();
+                started = false;
+            }
+        } else {
+            token += c;
+            started = true;
+        }
+    }
+    if (started) {
+        tokens.push_back(token);
+    }
+
+    return tokens;
+}
+
+bool parseNumber(const std::string& text, long long& value) {
+    try {
+        size_t used;
+        value = std::stoll(text, &used);
+        return used == text.size();
+    } catch (const std::exception& e) {
+        return false;
+    }
+}
+
+bool parseNumber(const std::string& text, double& value) {
+    try {
+        size_t used;
+        value = std::stod(text, &used);
+        return used == text.size();
+    } catch (const std::exception& e) {
+        return false;
+    }
+}
+
+std::string ok(const std::string& text = "") {
+    return text.empty() ? "OK\n" : "OK " + text + "\n";
+}
+
+std::string err(const std::string& reason) {
+    return "ERR " + reason + "\n";
+}
+
+// "OK <n>" then one line per entry
+std::string lines(const std::vector<std::string>& entries) {
+    std::string response = "OK " + std::to_string(entries.size()) + "\n";
+    for (const auto& entry : entries) {
+        response += entry;
+        response += '\n';
+    }
+    return response;
+}
+
+bool setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0 && fcntl(fd, F_SETFD, FD_CLOEXEC) == 0;
+}
+
+const char* const HELP[] = {
+    "login <user> <password>",
+    "logout",
+    "create <type> <location> <date> <duration>",
+    "emergency <location> <date> <duration> <priority> [specialty]",
+    "get <id>",
+    "list <date>",
+    "month <month> <year>",
+    "modify <id> <location|-> <date|0> <duration|0>",
+    "status <id> <status> [comments]",
+    "assign <id> <technician_id>",
+    "delete <id>",
+    "gps <id> <latitude> <longitude>",
+    "addtech <technician_id> <name> <specialty> [contact]",
+    "ping",
+    "help",
+    "quit"
+};
+
+} // namespace
+
+InterventionDaemon::InterventionDaemon(const std::string& socketPath,
+                                       std::shared_ptr<InterventionManager> manager,
+                                       std::shared_ptr<const AccessPolicy> policy,
+                                       size_t workerCount)
+    : socketPath(socketPath),
+      manager(manager ? std::move(manager) : std::make_shared<InterventionManager>()),
+      policy(policy ? std::move(policy) : std::make_shared<const AccessPolicy>(AccessPolicy::createDefault())),
+      auditLog(std::make_shared<AccessAuditLog>()),
+      auditFlusher(std::make_shared<AuditLogFlusher>(auditLog)),
+      workerCount(workerCount != 0 ? workerCount : std::max(1u, std::thread::hardware_concurrency())),
+      listenFd(-1),
+      wakeFds{-1, -1},
+      stopping(false),
+      nextSessionId(1) {
+
+    // Nobody reads the console of a daemon
+    auditLog->setEchoDenials(false);
+    this->manager->addObserver(auditFlusher);
+}
+
+InterventionDaemon::~InterventionDaemon() {
+    stopping = true;
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex);
+    }
+    tasksReady.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (auto& entry : sessions) {
+        close(entry.second->fd);
+    }
+    sessions.clear();
+    manager->removeObserver(auditFlusher.get());
+
+    if (listenFd >= 0) {
+        close(listenFd);
+        unlink(socketPath.c_str());
+    }
+    for (int fd : wakeFds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+bool InterventionDaemon::start() {
+    sockaddr_un address{};
+    if (listenFd >= 0 || socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+
+    // A closed client must not kill the daemon
+    std::signal(SIGPIPE, SIG_IGN);
+
+    if (pipe(wakeFds) != 0 || !setNonBlocking(wakeFds[0]) || !setNonBlocking(wakeFds[1])) {
+        return false;
+    }
+
+    // Replace the socket of a previous run, never another kind of file
+    struct stat existing;
+    if (stat(socketPath.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            return false;
+        }
+        unlink(socketPath.c_str());
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(fd, SOMAXCONN) != 0 || !setNonBlocking(fd)) {
+        close(fd);
+        return false;
+    }
+    listenFd = fd;
+
+    for (size_t i = 0; i < workerCount; i++) {
+        workers.emplace_back(&InterventionDaemon::runWorker, this);
+    }
+
+    return true;
+}
+
+void InterventionDaemon::run() {
+    if (listenFd < 0) {
+        return;
+    }
+
+    std::vector<pollfd> fds;
+    std::vector<Session*> polled;
+
+    while (!stopping) {
+        fds.clear();
+        polled.clear();
+        fds.push_back(pollfd{wakeFds[0], POLLIN, 0});
+        fds.push_back(pollfd{listenFd, POLLIN, 0});
+
+        for (auto& entry : sessions) {
+            Session& session = *entry.second;
+            if (session.disconnected) {
+                continue;
+            }
+
+            short events = 0;
+            if (!session.closing) {
+                events |= POLLIN;
+            }
+            if (!session.output.empty()) {
+                events |= POLLOUT;
+            }
+            if (events == 0) {
+                continue; // Closing and waiting for a worker: a hung-up socket would wake us in a loop
+            }
+            fds.push_back(pollfd{session.fd, events, 0});
+            polled.push_back(&session);
+        }
+
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            char drain[256];
+            while (read(wakeFds[0], drain, sizeof(drain)) > 0) {
+            }
+        }
+        collectCompletions();
+
+        if (fds[1].revents & POLLIN) {
+            acceptSessions();
+        }
+
+        for (size_t i = 0; i < polled.size(); i++) {
+            Session& session = *polled[i];
+            short events = fds[i + 2].revents;
+            if (events & (POLLIN | POLLHUP | POLLERR)) {
+                readSession(session);
+            }
+            if ((events & POLLOUT) && !session.disconnected) {
+                writeSession(session);
+            }
+        }
+
+        // Close the finished sessions; a session stays while a worker uses it
+        for (auto it = sessions.begin(); it != sessions.end();) {
+            Session& session = *it->second;
+            bool finished = session.disconnected ||
+                            (session.closing && session.pending.empty() && session.output.empty());
+            if (finished && !session.busy) {
+                close(session.fd);
+                it = sessions.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.activeSessions = sessions.size();
+    }
+}
+
+void InterventionDaemon::stop() {
+    stopping = true;
+    wake();
+}
+
+void InterventionDaemon::wake() {
+    char signal = 1;
+    ssize_t written = write(wakeFds[1], &signal, 1); // A full pipe already wakes the loop
+    (void)written;
+}
+
+void InterventionDaemon::acceptSessions() {
+    while (true) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            return; // EAGAIN: no more pending connections
+        }
+        if (!setNonBlocking(fd)) {
+            close(fd);
+            continue;
+        }
+
+        auto session = std::make_unique<Session>();
+        session->id = nextSessionId++;
+        session->fd = fd;
+        sessions[session->id] = std::move(session);
+
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.sessionsOpened++;
+    }
+}
+
+void InterventionDaemon::readSession(Session& session) {
+    char buffer[16 * 1024];
+    while (true) {
+        ssize_t received = read(session.fd, buffer, sizeof(buffer));
+        if (received > 0) {
+            session.input.append(buffer, static_cast<size_t>(received));
+            continue;
+        }
+        if (received == 0) {
+            // The client is done sending: answer what it sent, then close
+            session.closing = true;
+        } else if (errno == EINTR) {
+            continue;
+        } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            session.disconnected = true;
+            return;
+        }
+        break;
+    }
+
+    size_t start = 0;
+    size_t end;
+    while ((end = session.input.find('\n', start)) != std::string::npos) {
+        size_t length = end - start;
+        if (length > 0 && session.input[end - 1] == '\r') {
+            length--;
+        }
+        if (length > 0) {
+            session.pending.push_back(session.input.substr(start, length));
+        }
+        start = end + 1;
+    }
+    session.input.erase(0, start);
+
+    if (session.input.size() > MAX_REQUEST_LENGTH) {
+        session.input.clear();
+        session.pending.push_back(""); // Keeps the error in order with the earlier responses
+        session.closing = true;
+    }
+
+    dispatchNext(session);
+}
+
+void InterventionDaemon::writeSession(Session& session) {
+    size_t written = 0;
+    while (written < session.output.size()) {
+        ssize_t sent = write(session.fd, session.output.data() + written, session.output.size() - written);
+        if (sent > 0) {
+            written += static_cast<size_t>(sent);
+        } else if (sent < 0 && errno == EINTR) {
+            continue;
+        } else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            session.disconnected = true;
+            session.output.clear();
+            return;
+        }
+    }
+    session.output.erase(0, written);
+}
+
+void InterventionDaemon::dispatchNext(Session& session) {
+    if (session.busy || session.pending.empty() || session.disconnected) {
+        return;
+    }
+
+    session.busy = true;
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex);
+        tasks.push_back(Task{session.id, &session, std::move(session.pending.front())});
+    }
+    session.pending.pop_front();
+    tasksReady.notify_one();
+}
+
+void InterventionDaemon::collectCompletions() {
+    std::vector<Completion> done;
+    {
+        std::lock_guard<std::mutex> lock(completionsMutex);
+        done.swap(completions);
+    }
+
+    for (auto& completion : done) {
+        auto it = sessions.find(completion.sessionId);
+        if (it == sessions.end()) {
+            continue;
+        }
+
+        Session& session = *it->second;
+        session.busy = false;
+        if (session.disconnected) {
+            continue;
+        }
+
+        session.output += completion.response;
+        if (completion.close) {
+            session.closing = true;
+            session.pending.clear();
+        }
+
+        // Write right away: most responses fit the socket buffer
+        writeSession(session);
+        dispatchNext(session);
+    }
+}
+
+void InterventionDaemon::runWorker() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(tasksMutex);
+            tasksReady.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (stopping) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+
+        bool close = false;
+        std::string response = task.request.empty()
+                                   ? err("request too long")
+                                   : handleRequest(*task.session, task.request, close);
+
+        {
+            std::lock_guard<std::mutex> lock(completionsMutex);
+            completions.push_back(Completion{task.sessionId, std::move(response), close});
+        }
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            stats.requests++;
+        }
+        wake();
+    }
+}
+
+std::string InterventionDaemon::handleRequest(Session& session, const std::string& request, bool& close) {
+    std::vector<std::string> args = tokenize(request);
+    if (args.empty()) {
+        return err("empty request");
+    }
+
+    std::string command = args[0];
+    args.erase(args.begin());
+
+    if (command == "ping") {
+        return ok("pong");
+    }
+
+    if (command == "quit") {
+        close = true;
+        return ok("bye");
+    }
+
+    if (command == "help") {
+        return lines(std::vector<std::string>(std::begin(HELP), std::end(HELP)));
+    }
+
+    if (command == "login") {
+        if (args.size() != 2) {
+            return err("usage: login <user> <password>");
+        }
+        if (session.proxy) {
+            return err("already logged in as " + session.user);
+        }
+        if (!authSystem.checkCredentials(args[0], args[1])) {
+            return err("invalid username or password");
+        }
+
+        // A lightweight proxy per session, all over the same manager
+        std::string role = authSystem.getUserRole(args[0]);
+        session.user = args[0];
+        session.proxy = std::make_unique<InterventionManagerSecure>(args[0], manager, policy, role);
+        session.proxy->setAuditLog(auditLog);
+        return ok(role);
+    }
+
+    if (!session.proxy) {
+        return err("login first");
+    }
+    InterventionManagerSecure& proxy = *session.proxy;
+
+    if (command == "logout") {
+        session.proxy.reset();
+        session.user.clear();
+        return ok();
+    }
+
+    long long id = 0;
+    bool hasId = !args.empty() && parseNumber(args[0], id);
+
+    if (command == "create") {
+        long long date, duration;
+        if (args.size() != 4 || !parseNumber(args[2], date) || !parseNumber(args[3], duration)) {
+            return err("usage: create <type> <location> <date> <duration>");
+        }
+        int created = proxy.createIntervention(args[0], args[1], static_cast<std::time_t>(date),
+                                               static_cast<int>(duration));
+        return created > 0 ? ok(std::to_string(created)) : err("refused");
+    }
+
+    if (command == "emergency") {
+        long long date, duration, priority;
+        if (args.size() < 4 || !parseNumber(args[1], date) || !parseNumber(args[2], duration) ||
+            !parseNumber(args[3], priority)) {
+            return err("usage: emergency <location> <date> <duration> <priority> [specialty]");
+        }
+        int created = proxy.createEmergencyIntervention(args[0], static_cast<std::time_t>(date),
+                                                        static_cast<int>(duration), static_cast<int>(priority),
+                                                        args.size() > 4 ? args[4] : "");
+        return created > 0 ? ok(std::to_string(created)) : err("refused");
+    }
+
+    if (command == "get") {
+        if (!hasId) {
+            return err("usage: get <id>");
+        }
+        std::string info = proxy.getInterventionInfo(static_cast<int>(id));
+        if (info.empty()) {
+            return err("not found or denied");
+        }
+        std::vector<std::string> infoLines;
+        std::istringstream stream(info);
+        std::string line;
+        while (std::getline(stream, line)) {
+            infoLines.push_back(line);
+        }
+        return lines(infoLines);
+    }
+
+    if (command == "list") {
+        if (!hasId) {
+            return err("usage: list <date>");
+        }
+        std::vector<std::string> entries;
+        // The pointers stay valid only under the manager's lock, whoever modifies or deletes
+        std::unique_lock<std::recursive_mutex> lock = manager->lockState();
+        for (const Intervention* intervention : proxy.getInterventionsForDay(static_cast<std::time_t>(id))) {
+            std::string entry = std::to_string(intervention->getId());
+            entry += '\t';
+            entry += intervention->getTypeView();
+            entry += '\t';
+            entry += intervention->getLocationView();
+            entry += '\t' + std::to_string(intervention->getDate()) + '\t' + std::to_string(intervention->getDuration());
+            entry += '\t';
+            entry += intervention->getStatusView();
+            entry += '\t';
+            entry += intervention->getTechnicianIdView();
+            entries.push_back(std::move(entry));
+        }
+        return lines(entries);
+    }
+
+    if (command == "month") {
+        long long year;
+        if (args.size() != 2 || !hasId || !parseNumber(args[1], year)) {
+            return err("usage: month <month> <year>");
+        }
+        std::vector<std::string> entries;
+        for (const auto& count : proxy.getInterventionCountsForMonth(static_cast<int>(id), static_cast<int>(year))) {
+            entries.push_back(std::to_string(count.first) + " " + std::to_string(count.second));
+        }
+        return lines(entries);
+    }
+
+    if (command == "modify") {
+        long long date, duration;
+        if (args.size() != 4 || !hasId || !parseNumber(args[2], date) || !parseNumber(args[3], duration)) {
+            return err("usage: modify <id> <location|-> <date|0> <duration|0>");
+        }
+        bool modified = proxy.modifyIntervention(static_cast<int>(id), args[1] == "-" ? "" : args[1],
+                                                 static_cast<std::time_t>(date), static_cast<int>(duration));
+        return modified ? ok() : err("refused");
+    }
+
+    if (command == "status") {
+        if (args.size() < 2 || !hasId) {
+            return err("usage: status <id> <status> [comments]");
+        }
+        bool changed = proxy.changeInterventionStatus(static_cast<int>(id), args[1], args.size() > 2 ? args[2] : "");
+        return changed ? ok() : err("refused");
+    }
+
+    if (command == "assign") {
+        if (args.size() != 2 || !hasId) {
+            return err("usage: assign <id> <technician_id>");
+        }
+        return proxy.assignTechnician(static_cast<int>(id), args[1]) ? ok() : err("refused");
+    }
+
+    if (command == "delete") {
+        if (!hasId) {
+            return err("usage: delete <id>");
+        }
+        return proxy.deleteIntervention(static_cast<int>(id)) ? ok() : err("refused");
+    }
+
+    if (command == "gps") {
+        double latitude, longitude;
+        if (args.size() != 3 || !hasId || !parseNumber(args[1], latitude) || !parseNumber(args[2], longitude)) {
+            return err("usage: gps <id> <latitude> <longitude>");
+        }
+        return proxy.addGPSCoordinate(static_cast<int>(id), latitude, longitude) ? ok() : err("refused");
+    }
+
+    if (command == "addtech") {
+        if (args.size() < 3) {
+            return err("usage: addtech <technician_id> <name> <specialty> [contact]");
+        }
+        // Technicians are managed on the real manager, as in the CLI
+        InterventionManager* realManager = proxy.getRealManager();
+        if (realManager == nullptr) {
+            return err("refused");
+        }
+        Technician technician(args[0], args[1], args[2], args.size() > 3 ? args[3] : "");
+        return realManager->addTechnician(technician) ? ok() : err("refused");
+    }
+
+    return err("unknown request '" + command + "', send 'help'");
+}
+
+std::shared_ptr<InterventionManager> InterventionDaemon::getManager() const {
+    return manager;
+}
+
+std::shared_ptr<AccessAuditLog> InterventionDaemon::getAuditLog() const {
+    return auditLog;
+}
+
+InterventionDaemon::Stats InterventionDaemon::getStats() const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return stats;
+}
@@ -3,14 +3,60 @@
 #include "Factory/MaintenanceFactory.h"
 #include "Factory/EmergencyFactory.h"
 #include "CLI/CLI.h"
+#include <cstring>
+#ifndef WINDOWS_PLATFORM
+#include <csignal>
+#include "Server/InterventionDaemon.h"
 
-int main() {
+namespace {
+
+InterventionDaemon* runningDaemon = nullptr;
+
+void stopDaemon(int) {
+    runningDaemon->stop();
+}
+
+} // namespace
+#endif
+
+int main(int argc, char* argv[]) {
     // Initialize the registry with our factories
     auto& registry = InterventionFactoryRegistry::getInstance();
 
     registry.registerFactory("Maintenance", std::make_unique<MaintenanceFactory>());
     registry.registerFactory("Emergency", std::make_unique<EmergencyFactory>(4)); // Default priority 4
 
+    // No more types after startup: switch to the perfect-hashed lookup
+    registry.freeze();
+
+#ifndef WINDOWS_PLATFORM
+    // Server mode: sessions over a UNIX socket instead of the interactive CLI
+    if (argc == 3 && std::strcmp(argv[1], "--daemon") == 0) {
+        InterventionDaemon daemon(argv[2]);
+        if (!daemon.start()) {
+            std::cerr << "Cannot listen on " << argv[2] << std::endl;
+            return 1;
+        }
+
+        runningDaemon = &daemon;
+        std::signal(SIGINT, stopDaemon);
+        std::signal(SIGTERM, stopDaemon);
+
+        std::cout << "Listening on " << argv[2] << " (Ctrl+C to stop)" << std::endl;
+        daemon.run();
+
+        auto stats = daemon.getStats();
+        std::cout << "Stopped after " << stats.requests << " requests from "
+                  << stats.sessionsOpened << " sessions." << std::endl;
+        return 0;
+    }
+#endif
+
+    if (argc > 1) {
+        std::cerr << "Usage: " << argv[0] << " [--daemon <socket_path>]" << std::endl;
+        return 1;
+    }
+
     // Create and start the CLI
     CLI cli;
     cli.start();